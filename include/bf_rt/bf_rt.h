@@ -22,7 +22,9 @@ extern "C" {
 #include <bf_rt/bf_rt_learn.h>
 #include <bf_rt/bf_rt_session.h>
 #include <bf_rt/bf_rt_table.h>
+#include <bf_rt/bf_rt_table_arena.h>
 #include <bf_rt/bf_rt_table_attributes.h>
+#include <bf_rt/bf_rt_table_cursor.h>
 #include <bf_rt/bf_rt_table_data.h>
 #include <bf_rt/bf_rt_table_key.h>
 #include <bf_rt/bf_rt_table_operations.h>
@@ -18,9 +18,12 @@
 #include <bf_rt/bf_rt_learn.hpp>
 #include <bf_rt/bf_rt_session.hpp>
 #include <bf_rt/bf_rt_table.hpp>
+#include <bf_rt/bf_rt_table_arena.hpp>
 #include <bf_rt/bf_rt_table_attributes.hpp>
+#include <bf_rt/bf_rt_table_cursor.hpp>
 #include <bf_rt/bf_rt_table_data.hpp>
 #include <bf_rt/bf_rt_table_key.hpp>
+#include <bf_rt/bf_rt_table_packed.hpp>
 #include <bf_rt/bf_rt_table_operations.hpp>
 
 #endif  //_BF_RT_HPP
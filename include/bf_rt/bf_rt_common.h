@@ -87,6 +87,8 @@ DECLARE_HANDLE(bf_rt_table_attributes_hdl);
 DECLARE_HANDLE(bf_rt_entry_scope_arguments_hdl);
 DECLARE_HANDLE(bf_rt_learn_hdl);
 DECLARE_HANDLE(bf_rt_table_operations_hdl);
+DECLARE_HANDLE(bf_rt_table_cursor_hdl);
+DECLARE_HANDLE(bf_rt_table_arena_hdl);
 
 /**
  * @brief learn_data_hdl and table_data_hdl are the same,
@@ -28,6 +28,22 @@ bf_status_t bf_rt_info_get(const bf_dev_id_t dev_id,
                            const char *prog_name,
                            const bf_rt_info_hdl **info_hdl_ret);
 
+/**
+ * @brief Write the parsed BfRtInfo of a (device_id, program name) to a
+ * binary cache file. A program whose bfrt_cache_file in the device profile
+ * names a valid cache is loaded from it without parsing bf-rt.json and
+ * context.json.
+ *
+ * @param[in] dev_id Device ID
+ * @param[in] prog_name Name of the P4 program
+ * @param[in] cache_file Path of the cache file to write
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_info_cache_write(const bf_dev_id_t dev_id,
+                                   const char *prog_name,
+                                   const char *cache_file);
+
 /**
  * @brief Get size of list of all device IDs currently added
  *
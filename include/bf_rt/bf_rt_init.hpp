@@ -62,6 +62,27 @@ class BfRtDevMgr {
                           const std::string &prog_name,
                           const BfRtInfo **bfrt_info) const;
 
+  /**
+   * @brief Write the parsed BfRtInfo of a (device_id, program name),
+   * including the table, field and action metadata taken from bf-rt.json
+   * and the context.json files, to a binary cache file. When the
+   * bfrt_cache_file of a program in the device profile names a valid
+   * cache, the BfRtInfo is mapped from it on device add and warm init
+   * instead of parsing the json files. A cache is valid when it was
+   * written by the same driver version and the hash of the json files it
+   * was built from matches the files named in the profile; an invalid
+   * cache is ignored and rewritten once the json files have been parsed.
+   *
+   * @param[in] dev_id Device ID
+   * @param[in] prog_name Name of the P4 program
+   * @param[in] cache_file Path of the cache file to write
+   *
+   * @return Status of the API call
+   */
+  bf_status_t bfRtInfoCacheWrite(const bf_dev_id_t &dev_id,
+                                 const std::string &prog_name,
+                                 const std::string &cache_file) const;
+
   /**
    * @brief Get a list of all device IDs currently added
    *
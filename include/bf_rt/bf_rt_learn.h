@@ -40,6 +40,54 @@ typedef bf_status_t (*bf_rt_cb_function)(
     bf_rt_learn_msg_hdl *const learn_msg_hdl,
     const void *cookie);
 
+/**
+ * @brief A batch of learn digests as delivered by a learn ring. @c records
+ * points to @c num_records fixed size records laid out back to back in a
+ * buffer owned by the driver. The records are decoded copies of the
+ * digests, not the BF_DMA_PIPE_LEARN_NOTIFY buffer itself. Every field of
+ * a record is in network order at the offset given by
+ * bf_rt_learn_field_offset_get(). The records stay valid until the batch
+ * is acked.
+ */
+typedef struct bf_rt_learn_record_batch_ {
+  /** Bf Rt target associated with the learn data */
+  bf_rt_target_t dev_tgt;
+  /** Start of the first record */
+  const uint8_t *records;
+  /** Number of records */
+  uint32_t num_records;
+  /** Size of every record in bytes */
+  uint32_t record_size;
+  /** Handle for the msg which needs to be acked */
+  bf_rt_learn_msg_hdl *learn_msg_hdl;
+} bf_rt_learn_record_batch_t;
+
+/**
+ * @brief Configuration of a learn ring
+ */
+typedef struct bf_rt_learn_ring_cfg_ {
+  /** Number of batches the ring can hold. Must be a power of 2 */
+  uint32_t ring_size;
+  /** Digests equal to one delivered less than this many microseconds ago
+   * are dropped before reaching the ring. 0 disables duplicate suppression
+   */
+  uint32_t dedup_window_us;
+} bf_rt_learn_ring_cfg_t;
+
+/**
+ * @brief Learn ring statistics
+ */
+typedef struct bf_rt_learn_ring_stats_ {
+  /** Number of batches put on the ring */
+  uint64_t batches;
+  /** Number of digests put on the ring */
+  uint64_t records;
+  /** Number of digests dropped as duplicates */
+  uint64_t duplicates;
+  /** Number of times the ring was found full by the learn path */
+  uint64_t ring_full;
+} bf_rt_learn_ring_stats_t;
+
 /**
  * @brief Register Callback function to be called on a Learn event
  *
@@ -86,6 +134,86 @@ bf_status_t bf_rt_learn_notify_ack(const bf_rt_learn_hdl *learn,
                                    const bf_rt_session_hdl *session,
                                    bf_rt_learn_msg_hdl *const learn_msg_hdl);
 
+/**
+ * @brief Notify the device that a set of learn_msgs were received and
+ * processed, in one call
+ *
+ * @param[in] learn Learn object handle
+ * @param[in] session Ptr to the session
+ * @param[in] learn_msg_hdls Array of handles of the msgs to be notified
+ * @param[in] num Size of the array
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_learn_notify_ack_batch(
+    const bf_rt_learn_hdl *learn,
+    const bf_rt_session_hdl *session,
+    bf_rt_learn_msg_hdl *const *learn_msg_hdls,
+    uint32_t num);
+
+/**
+ * @brief Attach a learn ring to the learn object instead of a callback.
+ * The learn path writes a batch per learn message on a lock-free single
+ * producer single consumer ring drained with bf_rt_learn_ring_poll().
+ * A learn object can have either a callback or a ring.
+ *
+ * @param[in] learn Learn object handle
+ * @param[in] session Ptr to the session
+ * @param[in] dev_tgt Device target
+ * @param[in] cfg Ring configuration
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_learn_ring_attach(const bf_rt_learn_hdl *learn,
+                                    const bf_rt_session_hdl *session,
+                                    const bf_rt_target_t *dev_tgt,
+                                    const bf_rt_learn_ring_cfg_t *cfg);
+
+/**
+ * @brief Detach the learn ring from the device. Batches which were not
+ * polled yet are acked and dropped
+ *
+ * @param[in] learn Learn object handle
+ * @param[in] session Ptr to the session
+ * @param[in] dev_tgt Device target
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_learn_ring_detach(const bf_rt_learn_hdl *learn,
+                                    const bf_rt_session_hdl *session,
+                                    const bf_rt_target_t *dev_tgt);
+
+/**
+ * @brief Take batches off the learn ring. Must be called from one thread
+ * at a time
+ *
+ * @param[in] learn Learn object handle
+ * @param[in] dev_tgt Device target
+ * @param[out] batches Array of batches. User needs to allocate memory
+ * @param[in] max_batches Size of the array
+ * @param[out] num_returned Number of batches taken, 0 if the ring is empty
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_learn_ring_poll(const bf_rt_learn_hdl *learn,
+                                  const bf_rt_target_t *dev_tgt,
+                                  bf_rt_learn_record_batch_t *batches,
+                                  uint32_t max_batches,
+                                  uint32_t *num_returned);
+
+/**
+ * @brief Get the statistics of the learn ring
+ *
+ * @param[in] learn Learn object handle
+ * @param[in] dev_tgt Device target
+ * @param[out] stats Ring statistics
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_learn_ring_stats_get(const bf_rt_learn_hdl *learn,
+                                       const bf_rt_target_t *dev_tgt,
+                                       bf_rt_learn_ring_stats_t *stats);
+
 /**
  * @brief Get ID of the learn Object
  *
@@ -160,6 +288,31 @@ bf_status_t bf_rt_learn_field_size_get(const bf_rt_learn_hdl *learn,
                                        const bf_rt_id_t field_id,
                                        size_t *size);
 
+/**
+ * @brief Get the byte offset of the Learn Data Field within a record of a
+ * learn ring batch. The field takes ceil(size / 8) bytes
+ *
+ * @param[in] learn Learn object handle
+ * @param[in] field_id Data field ID
+ * @param[out] offset Offset of the Data field
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_learn_field_offset_get(const bf_rt_learn_hdl *learn,
+                                         const bf_rt_id_t field_id,
+                                         size_t *offset);
+
+/**
+ * @brief Get the size in bytes of a record of a learn ring batch
+ *
+ * @param[in] learn Learn object handle
+ * @param[out] size Size of a record
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_learn_record_size_get(const bf_rt_learn_hdl *learn,
+                                        size_t *size);
+
 /**
  * @brief Find out whether the Learn Data field is a pointer or not
  *
@@ -52,6 +52,55 @@ typedef std::function<bf_status_t(
     const void *cookie)>
     bfRtCbFunction;
 
+/**
+ * @brief A batch of learn digests as delivered by a learn ring. The digests
+ * are not converted into BfRtLearnData objects: @c records points to
+ * @c num_records fixed size records laid out back to back in a buffer
+ * owned by the driver. The records are decoded copies of the digests, not
+ * the BF_DMA_PIPE_LEARN_NOTIFY buffer itself. Every field of a record is
+ * in network order at the offset given by
+ * BfRtLearn::learnFieldOffsetGet(). The records stay valid until the
+ * batch is acked with BfRtLearn::bfRtLearnNotifyAck().
+ */
+struct BfRtLearnRecordBatch {
+  /** Bf Rt target associated with the learn data */
+  bf_rt_target_t dev_tgt;
+  /** Start of the first record */
+  const uint8_t *records;
+  /** Number of records */
+  uint32_t num_records;
+  /** Size of every record in bytes */
+  uint32_t record_size;
+  /** Handle for the msg which needs to be acked */
+  bf_rt_learn_msg_hdl *learn_msg_hdl;
+};
+
+/**
+ * @brief Configuration of a learn ring
+ */
+struct BfRtLearnRingCfg {
+  /** Number of batches the ring can hold. Must be a power of 2 */
+  uint32_t ring_size;
+  /** Digests equal to one delivered less than this many microseconds ago
+   * are dropped before reaching the ring. 0 disables duplicate suppression
+   */
+  uint32_t dedup_window_us;
+};
+
+/**
+ * @brief Learn ring statistics
+ */
+struct BfRtLearnRingStats {
+  /** Number of batches put on the ring */
+  uint64_t batches;
+  /** Number of digests put on the ring */
+  uint64_t records;
+  /** Number of digests dropped as duplicates */
+  uint64_t duplicates;
+  /** Number of times the ring was found full by the learn path */
+  uint64_t ring_full;
+};
+
 /**
  * @brief Class to contain metadata of Learn Obj and perform functions
  *  like register and deregister Learn Callback <br>
@@ -109,6 +158,80 @@ class BfRtLearn {
       const std::shared_ptr<BfRtSession> session,
       bf_rt_learn_msg_hdl *const learn_msg_hdl) const = 0;
 
+  /**
+   * @brief Notify the device that a set of learn_msgs were received and
+   * processed, in one call
+   *
+   * @param[in] session Shared_ptr to the session
+   * @param[in] learn_msg_hdls Handles of the msgs to be notified
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t bfRtLearnNotifyAck(
+      const std::shared_ptr<BfRtSession> session,
+      const std::vector<bf_rt_learn_msg_hdl *> &learn_msg_hdls) const = 0;
+
+  /**
+   * @brief Attach a learn ring to the learn object instead of a callback.
+   * The learn path writes a BfRtLearnRecordBatch per learn message on a
+   * lock-free single producer single consumer ring which the application
+   * drains with bfRtLearnRingPoll(), so that no object is allocated per
+   * digest and no session reference is copied per message. When the ring
+   * is full the learn path stops draining the learn DR until there is
+   * room again. A learn object can have either a callback or a ring.
+   *
+   * @param[in] session @c std::shared_ptr to the session
+   * @param[in] dev_tgt Device target
+   * @param[in] cfg Ring configuration
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t bfRtLearnRingAttach(
+      const std::shared_ptr<BfRtSession> session,
+      const bf_rt_target_t &dev_tgt,
+      const BfRtLearnRingCfg &cfg) const = 0;
+
+  /**
+   * @brief Detach the learn ring from the device. Batches which were not
+   * polled yet are acked and dropped
+   *
+   * @param[in] session @c std::shared_ptr to the session
+   * @param[in] dev_tgt Device target
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t bfRtLearnRingDetach(
+      const std::shared_ptr<BfRtSession> session,
+      const bf_rt_target_t &dev_tgt) const = 0;
+
+  /**
+   * @brief Take batches off the learn ring. Must be called from one thread
+   * at a time
+   *
+   * @param[in] dev_tgt Device target
+   * @param[in] max_batches Maximum number of batches to take
+   * @param[out] batches Vector the batches are appended to. Batches
+   *                     already in the vector are kept, nothing is
+   *                     appended if the ring is empty
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t bfRtLearnRingPoll(
+      const bf_rt_target_t &dev_tgt,
+      const uint32_t &max_batches,
+      std::vector<BfRtLearnRecordBatch> *batches) const = 0;
+
+  /**
+   * @brief Get the statistics of the learn ring
+   *
+   * @param[in] dev_tgt Device target
+   * @param[out] stats Ring statistics
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t bfRtLearnRingStatsGet(
+      const bf_rt_target_t &dev_tgt, BfRtLearnRingStats *stats) const = 0;
+
   /**
    * @brief Get ID of the learn Object
    *
@@ -160,6 +283,27 @@ class BfRtLearn {
   virtual bf_status_t learnFieldSizeGet(const bf_rt_id_t &field_id,
                                         size_t *size) const = 0;
 
+  /**
+   * @brief Get the byte offset of the Learn Data Field within a record of
+   * a BfRtLearnRecordBatch. The field takes ceil(size / 8) bytes
+   *
+   * @param[in] field_id Data field ID
+   * @param[out] offset Offset of the Data field
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t learnFieldOffsetGet(const bf_rt_id_t &field_id,
+                                          size_t *offset) const = 0;
+
+  /**
+   * @brief Get the size in bytes of a record of a BfRtLearnRecordBatch
+   *
+   * @param[out] size Size of a record
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t learnRecordSizeGet(size_t *size) const = 0;
+
   /**
    * @brief Find out whether the Learn Data field is a pointer or not
    *
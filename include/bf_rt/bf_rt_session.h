@@ -104,6 +104,35 @@ bf_status_t bf_rt_flush_batch(bf_rt_session_hdl *const session);
 bf_status_t bf_rt_end_batch(bf_rt_session_hdl *const session,
                             bool hwSynchronous);
 
+// Pipe parallelism functions
+/**
+ * @brief Set the number of per-pipe workers of a session. With more than
+ * one worker, the hardware updates of the session are sharded by pipe and
+ * every pipe is programmed by its own worker on its own DMA buffers. The
+ * workers are joined by bf_rt_session_complete_operations(),
+ * bf_rt_end_batch() and bf_rt_commit_transaction() with hwSynchronous set.
+ * Can only be changed when no batch or transaction is in progress.
+ *
+ * @param[in] session Ptr to session object
+ * @param[in] num_workers Number of workers. 0 or 1 means that all the pipes
+ * are programmed from the caller thread, which is the default
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_session_pipe_workers_set(bf_rt_session_hdl *const session,
+                                           uint32_t num_workers);
+
+/**
+ * @brief Get the number of per-pipe workers of a session
+ *
+ * @param[in] session Ptr to session object
+ * @param[out] num_workers Number of workers
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_session_pipe_workers_get(
+    const bf_rt_session_hdl *const session, uint32_t *num_workers);
+
 // Transaction functions
 /**
  * @brief Begin a transaction on a session. Only one transaction can be in
@@ -121,6 +150,24 @@ bf_status_t bf_rt_end_batch(bf_rt_session_hdl *const session,
 bf_status_t bf_rt_begin_transaction(bf_rt_session_hdl *const session,
                                     bool isAtomic);
 
+/**
+ * @brief Begin an atomic transaction in which the given match tables are
+ * double buffered. Changes to those tables are built in their spare match
+ * and action memory and activated with a single version bit flip by
+ * bf_rt_commit_transaction(). A table entry call made in the transaction
+ * on one of the tables fails with BF_NO_SYS_RESOURCES if its change does
+ * not fit in the spare memory left to the shadow copy
+ *
+ * @param[in] session Ptr to session object
+ * @param[in] tables Array of tables to double buffer
+ * @param[in] num_tables Size of the array
+ * @return Status of the API call. BF_NOT_SUPPORTED if a table cannot be
+ * double buffered
+ */
+bf_status_t bf_rt_begin_shadow_transaction(bf_rt_session_hdl *const session,
+                                           const bf_rt_table_hdl **tables,
+                                           uint32_t num_tables);
+
 /**
  * @brief Verify if all the API requests against the transaction in progress
  *have
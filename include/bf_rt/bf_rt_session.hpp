@@ -20,6 +20,8 @@
 
 namespace bfrt {
 
+class BfRtTable;
+
 /**
  * @brief Class to create session objects. <br>
  * <B>Creation: </B> Can only be created using \ref
@@ -117,6 +119,42 @@ class BfRtSession {
   virtual bf_status_t endBatch(bool hwSynchronous) const = 0;
   /** @} */  // End of group Batching
 
+  /**
+   * @name Pipe parallelism APIs
+   * @{
+   */
+  /**
+   * @brief Set the number of per-pipe workers of a session. With more than
+   * one worker, the hardware updates of the session are sharded by pipe:
+   * every pipe is served by one worker which builds and pushes the
+   * instruction lists of that pipe on its own DMA buffers, so that updates of
+   * asymmetric tables on different pipes are programmed concurrently. Table
+   * APIs still update the software state in the caller context and return
+   * the status of the request; only the hardware push is deferred to the
+   * workers. The workers are joined by sessionCompleteOperations(),
+   * endBatch() and commitTransaction() with hwSynchronous set, which also
+   * return the first error hit by any of the workers. Updates to all pipes
+   * keep their order with respect to single pipe updates of the same table.
+   * Can only be changed when no batch or transaction is in progress.
+   *
+   * @param[in] num_workers Number of workers. 0 or 1 means that the session
+   * programs all the pipes from the caller thread, which is the default.
+   * Values larger than the number of pipes of the device are capped
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t pipeWorkersSet(const uint32_t &num_workers) const = 0;
+
+  /**
+   * @brief Get the number of per-pipe workers of a session
+   *
+   * @param[out] num_workers Number of workers
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t pipeWorkersGet(uint32_t *num_workers) const = 0;
+  /** @} */  // End of group Pipe parallelism
+
   /**
    * @name Transaction
    * Transaction APIs
@@ -137,6 +175,29 @@ class BfRtSession {
    */
   virtual bf_status_t beginTransaction(bool isAtomic) const = 0;
 
+  /**
+   * @brief Begin an atomic transaction in which the given match tables are
+   * double buffered. Every table starts with a shadow copy of its entries
+   * which is built in the spare match and action memory of the table, and
+   * all the changes made to those tables in the transaction go to the
+   * shadow copy only. commitTransaction() then activates the shadow copies
+   * of all tables with a single version bit flip, so the commit latency
+   * does not depend on the number of changes. A table can be replaced as a
+   * whole by clearing it first in the transaction. Changes to other tables
+   * are handled like in beginTransaction() with isAtomic set.<br>
+   * A table entry call made in the transaction on one of the tables fails
+   * with BF_NO_SYS_RESOURCES if its change does not fit in the spare
+   * memory left to the shadow copy; the transaction stays open and the
+   * change is not part of it
+   *
+   * @param[in] tables Tables to double buffer
+   *
+   * @return Status of the API call. BF_NOT_SUPPORTED if a table cannot be
+   * double buffered
+   */
+  virtual bf_status_t beginShadowTransaction(
+      const std::vector<const BfRtTable *> &tables) const = 0;
+
   /**
    * @brief Verify if all the API requests against the transaction in progress
    *have
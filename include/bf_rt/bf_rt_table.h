@@ -15,7 +15,9 @@
 #include <bf_rt/bf_rt_table_data.h>
 #include <bf_rt/bf_rt_table_key.h>
 #include <bf_rt/bf_rt_table_operations.h>
+#include <bf_rt/bf_rt_table_arena.h>
 #include <bf_rt/bf_rt_table_attributes.h>
+#include <bf_rt/bf_rt_table_cursor.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -350,6 +352,89 @@ bf_status_t bf_rt_table_entry_del(const bf_rt_table_hdl *table_hdl,
                                   const uint64_t flags,
                                   const bf_rt_table_key_hdl *key);
 
+/**
+ * @brief Add a batch of entries to the table
+ *
+ * @details All the entries are validated and programmed as one request, so
+ * the per-entry overhead of the session layer is paid only once and the
+ * resulting hardware updates are pushed together in as few instruction
+ * list DMAs as possible. A failure of one entry does not stop the
+ * processing of the remaining ones.
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] session Session Object
+ * @param[in] dev_tgt Device target
+ * @param[in] flags Call flags
+ * @param[in] keys Array of Entry Keys. Size should be equal to num_entries
+ * @param[in] data Array of Entry Data. Size should be equal to num_entries
+ * @param[in] num_entries Number of entries in the batch
+ * @param[out] entry_status Array of per-entry status.
+ * User needs to allocate memory. Size should be equal to num_entries
+ *
+ * @return BF_SUCCESS if all the entries were added, else the status of the
+ * first entry which failed
+ */
+bf_status_t bf_rt_table_entry_add_batch(const bf_rt_table_hdl *table_hdl,
+                                        const bf_rt_session_hdl *session,
+                                        const bf_rt_target_t *dev_tgt,
+                                        const uint64_t flags,
+                                        bf_rt_table_key_hdl *const *keys,
+                                        bf_rt_table_data_hdl *const *data,
+                                        uint32_t num_entries,
+                                        bf_status_t *entry_status);
+
+/**
+ * @brief Modify a batch of existing entries of the table
+ *
+ * @details Same processing model as bf_rt_table_entry_add_batch()
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] session Session Object
+ * @param[in] dev_tgt Device target
+ * @param[in] flags Call flags
+ * @param[in] keys Array of Entry Keys. Size should be equal to num_entries
+ * @param[in] data Array of Entry Data. Size should be equal to num_entries
+ * @param[in] num_entries Number of entries in the batch
+ * @param[out] entry_status Array of per-entry status.
+ * User needs to allocate memory. Size should be equal to num_entries
+ *
+ * @return BF_SUCCESS if all the entries were modified, else the status of the
+ * first entry which failed
+ */
+bf_status_t bf_rt_table_entry_mod_batch(const bf_rt_table_hdl *table_hdl,
+                                        const bf_rt_session_hdl *session,
+                                        const bf_rt_target_t *dev_tgt,
+                                        const uint64_t flags,
+                                        bf_rt_table_key_hdl *const *keys,
+                                        bf_rt_table_data_hdl *const *data,
+                                        uint32_t num_entries,
+                                        bf_status_t *entry_status);
+
+/**
+ * @brief Delete a batch of entries of the table
+ *
+ * @details Same processing model as bf_rt_table_entry_add_batch()
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] session Session Object
+ * @param[in] dev_tgt Device target
+ * @param[in] flags Call flags
+ * @param[in] keys Array of Entry Keys. Size should be equal to num_entries
+ * @param[in] num_entries Number of entries in the batch
+ * @param[out] entry_status Array of per-entry status.
+ * User needs to allocate memory. Size should be equal to num_entries
+ *
+ * @return BF_SUCCESS if all the entries were deleted, else the status of the
+ * first entry which failed
+ */
+bf_status_t bf_rt_table_entry_del_batch(const bf_rt_table_hdl *table_hdl,
+                                        const bf_rt_session_hdl *session,
+                                        const bf_rt_target_t *dev_tgt,
+                                        const uint64_t flags,
+                                        bf_rt_table_key_hdl *const *keys,
+                                        uint32_t num_entries,
+                                        bf_status_t *entry_status);
+
 /**
  * @brief Reset an entry of the table to default value
  *
@@ -519,6 +604,40 @@ bf_status_t bf_rt_table_entry_get_next_n(const bf_rt_table_hdl *table_hdl,
                                          uint32_t n,
                                          uint32_t *num_returned);
 
+/**
+ * @brief Allocate a cursor to stream all the entries of the table in
+ * chunks of at most chunk_size entries. The key/data objects are allocated
+ * once by the cursor and reused for every chunk.
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] session Session Object. Needs to outlive the cursor
+ * @param[in] dev_tgt Device target
+ * @param[in] flags Call flags. BF_RT_FROM_HW selects whether entries are
+ * read from HW or SW
+ * @param[in] chunk_size Number of key/data slots of the cursor.
+ * Must be greater than zero
+ * @param[out] cursor_hdl_ret Cursor object returned
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_entry_cursor_allocate(
+    const bf_rt_table_hdl *table_hdl,
+    const bf_rt_session_hdl *session,
+    const bf_rt_target_t *dev_tgt,
+    const uint64_t flags,
+    const uint32_t chunk_size,
+    bf_rt_table_cursor_hdl **cursor_hdl_ret);
+
+/**
+ * @brief Deallocate a table cursor object
+ *
+ * @param[in] cursor_hdl Cursor object
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_entry_cursor_deallocate(
+    bf_rt_table_cursor_hdl *cursor_hdl);
+
 /**
  * @brief Current Usage of the table
  *
@@ -1056,6 +1175,21 @@ bf_status_t bf_rt_table_api_supported(const bf_rt_table_hdl *table_hdl,
 bf_status_t bf_rt_table_key_allocate(const bf_rt_table_hdl *table_hdl,
                                      bf_rt_table_key_hdl **key_hdl_ret);
 
+/**
+ * @brief Allocate key for the table out of an arena. The key must not be
+ * deallocated; it is released by bf_rt_table_arena_reset()
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] arena_hdl Arena object
+ * @param[out] key_hdl_ret Key object returned
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_key_allocate_from_arena(
+    const bf_rt_table_hdl *table_hdl,
+    bf_rt_table_arena_hdl *arena_hdl,
+    bf_rt_table_key_hdl **key_hdl_ret);
+
 /**
  * @brief Reset the key object associated with the table
  *
@@ -1235,6 +1369,38 @@ bf_status_t bf_rt_table_action_data_allocate(
     const bf_rt_id_t action_id,
     bf_rt_table_data_hdl **data_hdl_ret);
 
+/**
+ * @brief Allocate Data Object for the table out of an arena. The data must
+ * not be deallocated; it is released by bf_rt_table_arena_reset()
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] arena_hdl Arena object
+ * @param[out] data_hdl_ret Data Object returned
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_data_allocate_from_arena(
+    const bf_rt_table_hdl *table_hdl,
+    bf_rt_table_arena_hdl *arena_hdl,
+    bf_rt_table_data_hdl **data_hdl_ret);
+
+/**
+ * @brief Allocate Data Object for the table out of an arena. The data must
+ * not be deallocated; it is released by bf_rt_table_arena_reset()
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] arena_hdl Arena object
+ * @param[in] action_id Action ID
+ * @param[out] data_hdl_ret Data Object returned
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_action_data_allocate_from_arena(
+    const bf_rt_table_hdl *table_hdl,
+    bf_rt_table_arena_hdl *arena_hdl,
+    const bf_rt_id_t action_id,
+    bf_rt_table_data_hdl **data_hdl_ret);
+
 /**
  * @brief Data Allocate with a list of field-ids. This allocates the data
  * object for
@@ -2333,6 +2499,27 @@ bf_status_t bf_rt_table_operations_execute(
     const bf_rt_table_hdl *table_hdl,
     const bf_rt_table_operations_hdl *tbl_ops);
 
+/**
+ * @brief Get the shared memory snapshot filled by
+ * BFRT_REGISTER_SNAPSHOT_SYNC. The snapshot is created on the first call
+ * and can be opened read only with shm_open() and mapped with mmap() by
+ * any process
+ *
+ * @param[in] table_hdl Table object
+ * @param[in] dev_tgt Device target
+ * @param[out] shm_name Name of the shared memory object. The string is
+ *                      owned by the table object and must not be freed.
+ *                      It stays valid until the program or the device is
+ *                      removed
+ * @param[out] size Size of the snapshot in bytes
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_register_snapshot_get(const bf_rt_table_hdl *table_hdl,
+                                              const bf_rt_target_t *dev_tgt,
+                                              const char **shm_name,
+                                              size_t *size);
+
 /**
  * @brief Get the size of array of supported operations
  * @param[in] table_hdl Table object
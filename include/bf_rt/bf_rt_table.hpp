@@ -22,7 +22,9 @@
 #include <bf_rt/bf_rt_session.hpp>
 #include <bf_rt/bf_rt_table_data.hpp>
 #include <bf_rt/bf_rt_table_key.hpp>
+#include <bf_rt/bf_rt_table_arena.hpp>
 #include <bf_rt/bf_rt_table_attributes.hpp>
+#include <bf_rt/bf_rt_table_cursor.hpp>
 #include <bf_rt/bf_rt_table_operations.hpp>
 
 namespace bfrt {
@@ -340,6 +342,13 @@ class BfRtTable {
    */
   using keyDataPairs = std::vector<std::pair<BfRtTableKey *, BfRtTableData *>>;
 
+  /**
+   * @brief Vector of pair of const Key and Data. Used as the input of the
+   * batch entry APIs. The key and data objects are owned by the caller.
+   */
+  using keyDataConstPairs =
+      std::vector<std::pair<const BfRtTableKey *, const BfRtTableData *>>;
+
   virtual ~BfRtTable() = default;
   //// Table APIs
   /**
@@ -949,6 +958,31 @@ class BfRtTable {
                                           keyDataPairs *key_data_pairs,
                                           uint32_t *num_returned) const = 0;
 
+  /**
+   * @brief Allocate a cursor to stream all the entries of the table in
+   * chunks of at most chunk_size entries. Unlike tableEntryGetNext_n(), the
+   * key/data objects are allocated once by the cursor and reused for every
+   * chunk, so the memory used by a full table walk does not depend on the
+   * size of the table.
+   *
+   * @param[in] session Session Object. Needs to outlive the cursor
+   * @param[in] dev_tgt Device target
+   * @param[in] flags Call flags. \ref BF_RT_FROM_HW selects whether entries
+   * are read from HW or SW
+   * @param[in] chunk_size Number of key/data slots of the cursor.
+   * Must be greater than zero
+   * @param[out] cursor Cursor Object returned, positioned before the first
+   * entry of the table
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t tableEntryCursorAllocate(
+      const BfRtSession &session,
+      const bf_rt_target_t &dev_tgt,
+      const uint64_t &flags,
+      const uint32_t &chunk_size,
+      std::unique_ptr<BfRtTableCursor> *cursor) const = 0;
+
   /**
    * @brief Current Usage of the table
    *
@@ -981,6 +1015,163 @@ class BfRtTable {
                                    const uint64_t &flags,
                                    size_t *size) const = 0;
 
+  /**
+   * @brief Add a batch of entries to the table
+   *
+   * @details All the entries are validated and programmed as one request, so
+   * the per-entry overhead of the session layer is paid only once and the
+   * resulting hardware updates are pushed together in as few instruction
+   * list DMAs as possible. A failure of one entry does not stop the
+   * processing of the remaining ones; the outcome of every entry is reported
+   * in @c entry_status.
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] flags Call flags
+   * @param[in] key_data_pairs Vector of Pairs(key, data) to be added
+   * @param[out] entry_status Vector of per-entry status. It is resized to
+   * the size of @c key_data_pairs and entry i holds the status of pair i
+   *
+   * @return BF_SUCCESS if all the entries were added, else the status of
+   * the first entry which failed
+   */
+  virtual bf_status_t tableEntryAddBatch(
+      const BfRtSession &session,
+      const bf_rt_target_t &dev_tgt,
+      const uint64_t &flags,
+      const keyDataConstPairs &key_data_pairs,
+      std::vector<bf_status_t> *entry_status) const = 0;
+
+  /**
+   * @brief Modify a batch of existing entries of the table
+   *
+   * @details Same processing model as tableEntryAddBatch()
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] flags Call flags
+   * @param[in] key_data_pairs Vector of Pairs(key, data) to be modified
+   * @param[out] entry_status Vector of per-entry status. It is resized to
+   * the size of @c key_data_pairs and entry i holds the status of pair i
+   *
+   * @return BF_SUCCESS if all the entries were modified, else the status of
+   * the first entry which failed
+   */
+  virtual bf_status_t tableEntryModBatch(
+      const BfRtSession &session,
+      const bf_rt_target_t &dev_tgt,
+      const uint64_t &flags,
+      const keyDataConstPairs &key_data_pairs,
+      std::vector<bf_status_t> *entry_status) const = 0;
+
+  /**
+   * @brief Delete a batch of entries of the table
+   *
+   * @details Same processing model as tableEntryAddBatch()
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] flags Call flags
+   * @param[in] keys Vector of Keys of the entries to be deleted
+   * @param[out] entry_status Vector of per-entry status. It is resized to
+   * the size of @c keys and entry i holds the status of key i
+   *
+   * @return BF_SUCCESS if all the entries were deleted, else the status of
+   * the first entry which failed
+   */
+  virtual bf_status_t tableEntryDelBatch(
+      const BfRtSession &session,
+      const bf_rt_target_t &dev_tgt,
+      const uint64_t &flags,
+      const std::vector<const BfRtTableKey *> &keys,
+      std::vector<bf_status_t> *entry_status) const = 0;
+
+  /**
+   * @brief Get the ID of the packed layout of the table. See
+   * bf_rt_table_packed.hpp for the definition of the layout
+   *
+   * @param[out] layout_id Layout ID
+   *
+   * @return Status of the API call. BF_NOT_SUPPORTED if the table has no
+   * packed layout
+   */
+  virtual bf_status_t tablePackedLayoutIdGet(uint64_t *layout_id) const = 0;
+
+  /**
+   * @brief Add an entry to the table from packed key and data buffers.
+   * The buffers are copied as is into the internal representation of the
+   * entry; apart from the layout ID and the buffer sizes, no per-field
+   * validation is done.
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] flags Call flags
+   * @param[in] layout_id Layout ID the buffers were built for
+   * @param[in] key Packed key buffer
+   * @param[in] key_size Size of the key buffer in bytes
+   * @param[in] action_id Action ID. Ignored if table has no actions
+   * @param[in] data Packed data buffer
+   * @param[in] data_size Size of the data buffer in bytes
+   *
+   * @return Status of the API call. BF_INVALID_ARG if the layout ID or the
+   * buffer sizes do not match the table
+   */
+  virtual bf_status_t tableEntryAddPacked(const BfRtSession &session,
+                                          const bf_rt_target_t &dev_tgt,
+                                          const uint64_t &flags,
+                                          const uint64_t &layout_id,
+                                          const uint8_t *key,
+                                          const size_t &key_size,
+                                          const bf_rt_id_t &action_id,
+                                          const uint8_t *data,
+                                          const size_t &data_size) const = 0;
+
+  /**
+   * @brief Modify an existing entry of the table from packed key and data
+   * buffers. Same validation as tableEntryAddPacked()
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] flags Call flags
+   * @param[in] layout_id Layout ID the buffers were built for
+   * @param[in] key Packed key buffer
+   * @param[in] key_size Size of the key buffer in bytes
+   * @param[in] action_id Action ID. Ignored if table has no actions
+   * @param[in] data Packed data buffer
+   * @param[in] data_size Size of the data buffer in bytes
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t tableEntryModPacked(const BfRtSession &session,
+                                          const bf_rt_target_t &dev_tgt,
+                                          const uint64_t &flags,
+                                          const uint64_t &layout_id,
+                                          const uint8_t *key,
+                                          const size_t &key_size,
+                                          const bf_rt_id_t &action_id,
+                                          const uint8_t *data,
+                                          const size_t &data_size) const = 0;
+
+  /**
+   * @brief Delete an entry of the table from a packed key buffer.
+   * Same validation as tableEntryAddPacked()
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] flags Call flags
+   * @param[in] layout_id Layout ID the buffer was built for
+   * @param[in] key Packed key buffer
+   * @param[in] key_size Size of the key buffer in bytes
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t tableEntryDelPacked(const BfRtSession &session,
+                                          const bf_rt_target_t &dev_tgt,
+                                          const uint64_t &flags,
+                                          const uint64_t &layout_id,
+                                          const uint8_t *key,
+                                          const size_t &key_size) const = 0;
+
   /***** End of APIs with flags *******/
 
   /**
@@ -1065,6 +1256,18 @@ class BfRtTable {
   virtual bf_status_t keyAllocate(
       std::unique_ptr<BfRtTableKey> *key_ret) const = 0;
 
+  /**
+   * @brief Allocate key for the table out of an arena. The key is owned by
+   * the arena and released by \ref bfrt::BfRtTableArena::arenaReset()
+   *
+   * @param[in] arena Arena Object
+   * @param[out] key_ret Key object returned
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t keyAllocate(BfRtTableArena *arena,
+                                  BfRtTableKey **key_ret) const = 0;
+
   /**
    * @brief Get a vector of Key field IDs
    *
@@ -1202,6 +1405,34 @@ class BfRtTable {
       const bf_rt_id_t &action_id,
       std::unique_ptr<BfRtTableData> *data_ret) const = 0;
 
+  /**
+   * @brief Allocate Data Object for the table out of an arena. The data is
+   * owned by the arena and released by \ref
+   * bfrt::BfRtTableArena::arenaReset()
+   *
+   * @param[in] arena Arena Object
+   * @param[out] data_ret Data Object returned
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t dataAllocate(BfRtTableArena *arena,
+                                   BfRtTableData **data_ret) const = 0;
+
+  /**
+   * @brief Allocate Data Object for the table out of an arena. The data is
+   * owned by the arena and released by \ref
+   * bfrt::BfRtTableArena::arenaReset()
+   *
+   * @param[in] arena Arena Object
+   * @param[in] action_id Action ID
+   * @param[out] data_ret Data Object returned
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t dataAllocate(BfRtTableArena *arena,
+                                   const bf_rt_id_t &action_id,
+                                   BfRtTableData **data_ret) const = 0;
+
   /**
    * @brief Data Allocate with a list of field-ids. This allocates the data
    * object for
@@ -1932,6 +2163,23 @@ class BfRtTable {
    */
   virtual bf_status_t tableOperationsExecute(
       const BfRtTableOperations &tableOperations) const = 0;
+
+  /**
+   * @brief Get the shared memory snapshot filled by
+   * TableOperationsType::REGISTER_SNAPSHOT_SYNC. The snapshot is created
+   * on the first call and can be opened read only with shm_open() and
+   * mapped with mmap() by any process. See bf_rt_register_snapshot_hdr_t
+   * for its layout
+   *
+   * @param[in] dev_tgt Device target
+   * @param[out] shm_name Name of the shared memory object
+   * @param[out] size Size of the snapshot in bytes
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t tableRegisterSnapshotGet(const bf_rt_target_t &dev_tgt,
+                                               std::string *shm_name,
+                                               size_t *size) const = 0;
   /** @} */  // End of group Operations
 
   // Table update callback registration APIs
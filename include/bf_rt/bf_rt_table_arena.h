@@ -0,0 +1,85 @@
+/* 
+ * Copyright (c) Intel Corporation
+ * SPDX-License-Identifier: CC-BY-ND-4.0
+ */
+
+
+/** @file bf_rt_table_arena.h
+ *
+ * @brief Contains BF-RT Table arena APIs
+ */
+#ifndef _BF_RT_TABLE_ARENA_H
+#define _BF_RT_TABLE_ARENA_H
+
+#include <bf_rt/bf_rt_common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Arena statistics
+ */
+typedef struct bf_rt_table_arena_stats_ {
+  /** Number of key objects handed out since creation */
+  uint64_t key_allocs;
+  /** Number of data objects handed out since creation */
+  uint64_t data_allocs;
+  /** Number of arena resets since creation */
+  uint64_t resets;
+  /** Number of slabs obtained from the heap since creation */
+  uint64_t slab_allocs;
+  /** Bytes currently in use */
+  size_t bytes_used;
+  /** Bytes currently reserved, including free space */
+  size_t bytes_reserved;
+} bf_rt_table_arena_stats_t;
+
+/**
+ * @brief Create an arena to allocate Key and Data objects from.
+ * An arena is not thread safe.
+ *
+ * @param[in] slab_size Size in bytes of every slab. Zero selects the default
+ * @param[out] arena_hdl_ret Arena object returned
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_arena_create(size_t slab_size,
+                                     bf_rt_table_arena_hdl **arena_hdl_ret);
+
+/**
+ * @brief Destroy an arena and all the objects allocated from it
+ *
+ * @param[in] arena_hdl Arena object
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_arena_destroy(bf_rt_table_arena_hdl *arena_hdl);
+
+/**
+ * @brief Release all the objects allocated from the arena. The objects
+ * stay constructed and are reset in place when allocated again. The slabs
+ * are kept for reuse.
+ *
+ * @param[in] arena_hdl Arena object
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_arena_reset(bf_rt_table_arena_hdl *arena_hdl);
+
+/**
+ * @brief Get the statistics of the arena
+ *
+ * @param[in] arena_hdl Arena object
+ * @param[out] stats Arena statistics
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_arena_stats_get(const bf_rt_table_arena_hdl *arena_hdl,
+                                        bf_rt_table_arena_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // _BF_RT_TABLE_ARENA_H
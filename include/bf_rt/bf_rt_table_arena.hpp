@@ -0,0 +1,91 @@
+/* 
+ * Copyright (c) Intel Corporation
+ * SPDX-License-Identifier: CC-BY-ND-4.0
+ */
+
+
+/** @file bf_rt_table_arena.hpp
+ *
+ *  @brief Contains BF-RT Table Arena APIs
+ */
+#ifndef _BF_RT_TABLE_ARENA_HPP
+#define _BF_RT_TABLE_ARENA_HPP
+
+#include <memory>
+
+#include <bf_rt/bf_rt_common.h>
+
+namespace bfrt {
+
+/**
+ * @brief Arena statistics. Used to compare the allocation behaviour of
+ * arena allocation against keyReset()/dataReset() object reuse.
+ */
+struct BfRtTableArenaStats {
+  /** Number of key objects handed out since creation */
+  uint64_t key_allocs;
+  /** Number of data objects handed out since creation */
+  uint64_t data_allocs;
+  /** Number of arena resets since creation */
+  uint64_t resets;
+  /** Number of slabs obtained from the heap since creation */
+  uint64_t slab_allocs;
+  /** Bytes currently in use */
+  size_t bytes_used;
+  /** Bytes currently reserved, including free space */
+  size_t bytes_reserved;
+};
+
+/**
+ * @brief Class to allocate Key and Data objects out of a slab instead of the
+ * heap.<br>
+ * Key and data objects are constructed in place in the slab and kept on a
+ * free list per (table, action) instead of being destroyed. Objects
+ * allocated from an arena are never freed individually; arenaReset()
+ * moves all of them back to their free list, and a later allocation for
+ * the same (table, action) hands out one of them again after resetting it
+ * in place with keyReset()/dataReset(), so a steady state workload does
+ * no heap allocation and no object construction. Destructors run only
+ * when the arena is destroyed. Using an object after the arena it came
+ * from was reset or destroyed is undefined.<br>
+ * An arena is not thread safe. The expected usage is one arena per session
+ * or per thread, reset after every batch.<br>
+ * <B>Creation: </B> Can only be created using \ref
+ * bfrt::BfRtTableArena::arenaCreate()
+ */
+class BfRtTableArena {
+ public:
+  virtual ~BfRtTableArena() = default;
+
+  /**
+   * @brief Factory function to create an arena object
+   *
+   * @param[in] slab_size Size in bytes of every slab. The arena grows by
+   * whole slabs when the current one is exhausted. Zero selects the default
+   *
+   * @returns @c std::unique_ptr<BfRtTableArena> to arena object
+   */
+  static std::unique_ptr<BfRtTableArena> arenaCreate(const size_t &slab_size);
+
+  /**
+   * @brief Release all the objects allocated from the arena. The objects
+   * stay constructed and are reset in place when allocated again. The
+   * slabs are kept for reuse.
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t arenaReset() = 0;
+
+  /**
+   * @brief Get the statistics of the arena
+   *
+   * @param[out] stats Arena statistics
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t arenaStatsGet(BfRtTableArenaStats *stats) const = 0;
+};
+
+}  // namespace bfrt
+
+#endif  // _BF_RT_TABLE_ARENA_HPP
@@ -87,6 +87,39 @@ typedef bf_status_t (*bf_rt_idle_tmo_expiry_cb)(bf_rt_target_t *dev_tgt,
                                                 void *cookie);
 typedef bf_rt_idle_tmo_expiry_cb bf_rt_idle_tmo_active_cb;
 
+/**
+ * @brief Batched IdleTimeout Callback. Called once per sweep with the
+ * entries which expired (or became active) during that sweep
+ * @param[in] dev_tgt Device target
+ * @param[in] entry_hdls Array of entry handles
+ * @param[in] num_entries Number of entry handles
+ * @param[in] cookie User provided cookie during cb registration
+ */
+typedef bf_status_t (*bf_rt_idle_tmo_expiry_batch_cb)(
+    bf_rt_target_t *dev_tgt,
+    const bf_rt_handle_t *entry_hdls,
+    uint32_t num_entries,
+    void *cookie);
+typedef bf_rt_idle_tmo_expiry_batch_cb bf_rt_idle_tmo_active_batch_cb;
+
+/**
+ * @brief IdleTable sweep statistics
+ */
+typedef struct bf_rt_idle_table_stats_ {
+  /** Number of sweeps done */
+  uint64_t sweeps;
+  /** Duration of the last sweep in microseconds */
+  uint64_t last_sweep_us;
+  /** Longest sweep in microseconds */
+  uint64_t max_sweep_us;
+  /** Number of entries reported as expired */
+  uint64_t entries_expired;
+  /** Number of entries reported as active */
+  uint64_t entries_activated;
+  /** Number of entries expired or activated but not reported yet */
+  uint32_t backlog;
+} bf_rt_idle_table_stats_t;
+
 /**
  * @brief PortStatusChange Callback
  * @param[in] dev_tgt Device target
@@ -254,6 +287,77 @@ bf_status_t bf_rt_attributes_idle_table_2way_get(
     uint32_t *min_ttl,
     void **cookie);
 
+/**
+ * @brief Set IdleTable Notify Mode options with batched callbacks in the
+ * Attributes Object. Expiry is tracked on a timing wheel so a sweep only
+ * visits the entries due in it.
+ *
+ * @param[in] tbl_attr            Table attribute object handle
+ * @param[in] enable              Enable IdleTimeout table
+ * @param[in] idle_cb             Will be called with expired entries
+ * @param[in] active_cb           Will be called with activated entries.
+ *                                NULL gives 1 way notifications
+ * @param[in] ttl_query_interval  Inverval for querying entry TTL
+ * @param[in] max_ttl             Max. allowed entry TTL value - not used
+ * @param[in] min_ttl             Min. allowed entry TTL value - not used
+ * @param[in] max_batch           Max. entries per callback, 0 for no limit
+ * @param[in] cookie              Used with callbacks
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_attributes_idle_table_notify_mode_batch_set(
+    bf_rt_table_attributes_hdl *tbl_attr,
+    const bool enable,
+    const bf_rt_idle_tmo_expiry_batch_cb idle_cb,
+    const bf_rt_idle_tmo_active_batch_cb active_cb,
+    const uint32_t ttl_query_interval,
+    const uint32_t max_ttl,
+    const uint32_t min_ttl,
+    const uint32_t max_batch,
+    const void *cookie);
+
+/**
+ * @brief Get IdleTable configuration options for batched notifications in
+ * the Attributes Object
+ *
+ * @param[in] tbl_attr             Table attribute object handle
+ * @param[out] mode                IdleTable mode
+ * @param[out] enable              IdleTimeout table enable
+ * @param[out] idle_cb             Will be called with expired entries
+ * @param[out] active_cb           Will be called with activated entries
+ * @param[out] ttl_query_interval  Inverval for querying entry TTL
+ * @param[out] max_ttl             Max. allowed entry TTL value - not used
+ * @param[out] min_ttl             Min. allowed entry TTL value - not used
+ * @param[out] max_batch           Max. entries per callback
+ * @param[out] cookie              Used with callbacks
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_attributes_idle_table_batch_get(
+    const bf_rt_table_attributes_hdl *tbl_attr,
+    bf_rt_attributes_idle_table_mode_t *mode,
+    bool *enable,
+    bf_rt_idle_tmo_expiry_batch_cb *idle_cb,
+    bf_rt_idle_tmo_active_batch_cb *active_cb,
+    uint32_t *ttl_query_interval,
+    uint32_t *max_ttl,
+    uint32_t *min_ttl,
+    uint32_t *max_batch,
+    void **cookie);
+
+/**
+ * @brief Get IdleTable sweep statistics from an Attributes Object filled
+ * by bf_rt_table_attributes_get()
+ *
+ * @param[in] tbl_attr             Table attribute object handle
+ * @param[out] stats               Sweep statistics
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_attributes_idle_table_stats_get(
+    const bf_rt_table_attributes_hdl *tbl_attr,
+    bf_rt_idle_table_stats_t *stats);
+
 /**
  * @brief Set Port status notificaiton options in the Attributes Object
  *
@@ -128,6 +128,40 @@ typedef std::function<void(
     BfRtIdleTmoExpiryCb;
 typedef BfRtIdleTmoExpiryCb BfRtIdleTmoActiveCb;
 
+/**
+ * @brief Batched IdleTimeout Callback. Called once per sweep with the
+ * entries which expired (or became active) during that sweep
+ * @param[in] dev_tgt Device target
+ * @param[in] entry_hdls Array of entry handles. The key of an entry can be
+ * read with BfRtTable::tableEntryKeyGet() when needed
+ * @param[in] num_entries Number of entry handles
+ * @param[in] cookie User provided cookie during cb registration
+ */
+typedef std::function<void(const bf_rt_target_t &dev_tgt,
+                           const bf_rt_handle_t *entry_hdls,
+                           const uint32_t &num_entries,
+                           void *cookie)>
+    BfRtIdleTmoExpiryBatchCb;
+typedef BfRtIdleTmoExpiryBatchCb BfRtIdleTmoActiveBatchCb;
+
+/**
+ * @brief IdleTable sweep statistics
+ */
+struct BfRtIdleTableStats {
+  /** Number of sweeps done */
+  uint64_t sweeps;
+  /** Duration of the last sweep in microseconds */
+  uint64_t last_sweep_us;
+  /** Longest sweep in microseconds */
+  uint64_t max_sweep_us;
+  /** Number of entries reported as expired */
+  uint64_t entries_expired;
+  /** Number of entries reported as active */
+  uint64_t entries_activated;
+  /** Number of entries expired or activated but not reported yet */
+  uint32_t backlog;
+};
+
 /**
  * @brief PortStatusChange Callback
  * @param[in] dev_id Device ID
@@ -293,6 +327,74 @@ class BfRtTableAttributes {
       const uint32_t &min_ttl,
       const void *cookie) = 0;
 
+  /**
+   * @brief Set IdleTable Notify Mode options with batched callbacks. This is
+   * only valid if the Attributes Object was allocated with
+   * TableAttributesIdleTableMode::NOTIFY_MODE.
+   * Entries are kept on a hierarchical timing wheel keyed by the sweep in
+   * which their TTL runs out, and the hit state reported through
+   * BF_DMA_PIPE_IDLE_STATE_NOTIFY moves entries between slots. A sweep
+   * therefore only visits the entries due in the current slot instead of
+   * the whole table, and no BfRtTableKey is allocated per entry.
+   *
+   * @param[in] enable Flag to enable IdleTable
+   * @param[in] idle_cb Callback on IdleTime Timeout
+   * @param[in] active_cb Callback on IdleTime Activation. An empty
+   * std::function gives 1 way notifications
+   * @param[in] ttl_query_interval Ttl query interval
+   * @param[in] max_ttl Max ttl value that an entry can have
+   * @param[in] min_ttl Min ttl value that an entry can have
+   * @param[in] max_batch Max number of entries per callback. 0 means
+   * all the entries of a sweep go in one callback
+   * @param[in] cookie User cookie
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t idleTableNotifyModeBatchSet(
+      const bool &enable,
+      const BfRtIdleTmoExpiryBatchCb &idle_cb,
+      const BfRtIdleTmoActiveBatchCb &active_cb,
+      const uint32_t &ttl_query_interval,
+      const uint32_t &max_ttl,
+      const uint32_t &min_ttl,
+      const uint32_t &max_batch,
+      const void *cookie) = 0;
+
+  /**
+   * @brief Get Idle Table params for batched notifications
+   *
+   * @param[out] mode Mode of IdleTable (POLL/NOTIFY)
+   * @param[out] enable Enable flag
+   * @param[out] idle_cb Calbback on Idle Timeout
+   * @param[out] active_cb Calbback on Idle Activation
+   * @param[out] ttl_query_interval Ttl query interval
+   * @param[out] max_ttl Max ttl value that an entry can have
+   * @param[out] min_ttl Min ttl value that an entry can have
+   * @param[out] max_batch Max number of entries per callback
+   * @param[out] cookie User cookie
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t idleTableBatchGet(TableAttributesIdleTableMode *mode,
+                                        bool *enable,
+                                        BfRtIdleTmoExpiryBatchCb *idle_cb,
+                                        BfRtIdleTmoActiveBatchCb *active_cb,
+                                        uint32_t *ttl_query_interval,
+                                        uint32_t *max_ttl,
+                                        uint32_t *min_ttl,
+                                        uint32_t *max_batch,
+                                        void **cookie) const = 0;
+
+  /**
+   * @brief Get IdleTable sweep statistics. Valid on an Attributes Object
+   * filled by BfRtTable::tableAttributesGet()
+   *
+   * @param[out] stats Sweep statistics
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t idleTableStatsGet(BfRtIdleTableStats *stats) const = 0;
+
   /**
    * @brief Get Idle Table params
    *
@@ -0,0 +1,110 @@
+/* 
+ * Copyright (c) Intel Corporation
+ * SPDX-License-Identifier: CC-BY-ND-4.0
+ */
+
+
+/** @file bf_rt_table_cursor.h
+ *
+ * @brief Contains BF-RT Table cursor APIs
+ */
+#ifndef _BF_RT_TABLE_CURSOR_H
+#define _BF_RT_TABLE_CURSOR_H
+
+#include <bf_rt/bf_rt_common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fetch the next chunk of entries into the slots of the cursor.
+ * The entries of the previous chunk are overwritten.
+ *
+ * @param[in] cursor_hdl Table cursor handle
+ * @param[out] num_returned Number of entries fetched. Zero once the end of
+ * the table has been reached
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_cursor_next(bf_rt_table_cursor_hdl *cursor_hdl,
+                                    uint32_t *num_returned);
+
+/**
+ * @brief Get an entry of the current chunk. The returned objects are owned
+ * by the cursor and stay valid until the next call of
+ * bf_rt_table_cursor_next(), bf_rt_table_cursor_seek() or
+ * bf_rt_table_cursor_reset()
+ *
+ * @param[in] cursor_hdl Table cursor handle
+ * @param[in] index Index of the entry in the current chunk
+ * @param[out] key Entry Key
+ * @param[out] data Entry Data
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_cursor_entry_get(
+    const bf_rt_table_cursor_hdl *cursor_hdl,
+    const uint32_t index,
+    const bf_rt_table_key_hdl **key,
+    const bf_rt_table_data_hdl **data);
+
+/**
+ * @brief Get the number of key/data slots of the cursor
+ *
+ * @param[in] cursor_hdl Table cursor handle
+ * @param[out] chunk_size Number of slots
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_cursor_chunk_size_get(
+    const bf_rt_table_cursor_hdl *cursor_hdl, uint32_t *chunk_size);
+
+/**
+ * @brief Check whether the end of the table has been reached
+ *
+ * @param[in] cursor_hdl Table cursor handle
+ * @param[out] is_end True if no more entries are left
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_cursor_end(const bf_rt_table_cursor_hdl *cursor_hdl,
+                                   bool *is_end);
+
+/**
+ * @brief Get the key of the last entry returned by the cursor
+ *
+ * @param[in] cursor_hdl Table cursor handle
+ * @param[out] key Entry Key. Needs to be allocated from the same table
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_cursor_position_get(
+    const bf_rt_table_cursor_hdl *cursor_hdl, bf_rt_table_key_hdl *key);
+
+/**
+ * @brief Position the cursor so that the next chunk starts right after
+ * the entry specified by key
+ *
+ * @param[in] cursor_hdl Table cursor handle
+ * @param[in] key Entry Key
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_cursor_seek(bf_rt_table_cursor_hdl *cursor_hdl,
+                                    const bf_rt_table_key_hdl *key);
+
+/**
+ * @brief Position the cursor back on the first entry of the table
+ *
+ * @param[in] cursor_hdl Table cursor handle
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_table_cursor_reset(bf_rt_table_cursor_hdl *cursor_hdl);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // _BF_RT_TABLE_CURSOR_H
@@ -0,0 +1,115 @@
+/* 
+ * Copyright (c) Intel Corporation
+ * SPDX-License-Identifier: CC-BY-ND-4.0
+ */
+
+
+/** @file bf_rt_table_cursor.hpp
+ *
+ *  @brief Contains BF-RT Table Cursor APIs
+ */
+#ifndef _BF_RT_TABLE_CURSOR_HPP
+#define _BF_RT_TABLE_CURSOR_HPP
+
+#include <memory>
+
+#include <bf_rt/bf_rt_common.h>
+#include <bf_rt/bf_rt_table_key.hpp>
+#include <bf_rt/bf_rt_table_data.hpp>
+
+namespace bfrt {
+
+/**
+ * @brief Class to stream the entries of a table in chunks.<br>
+ * A cursor owns a fixed number of key/data slots which are allocated once
+ * and reused for every chunk, so walking a table of any size costs a
+ * bounded amount of memory. Entries are read from SW or HW depending upon
+ * the flags the cursor was allocated with (\ref BF_RT_FROM_HW).<br>
+ * The cursor remembers the last entry returned, so the caller is free to
+ * yield between two calls of cursorNext() and continue later. Entries added
+ * or deleted in the meantime are seen or skipped the same way as with
+ * \ref bfrt::BfRtTable::tableEntryGetNext_n().<br>
+ * The session used to allocate the cursor must outlive it.<br>
+ * <B>Creation: </B> Can only be created using \ref
+ * bfrt::BfRtTable::tableEntryCursorAllocate()
+ */
+class BfRtTableCursor {
+ public:
+  virtual ~BfRtTableCursor() = default;
+
+  /**
+   * @brief Fetch the next chunk of entries into the slots of the cursor.
+   * The entries of the previous chunk are overwritten.
+   *
+   * @param[out] num_returned Number of entries fetched. Zero once the end of
+   * the table has been reached
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t cursorNext(uint32_t *num_returned) = 0;
+
+  /**
+   * @brief Get an entry of the current chunk. The returned objects are owned
+   * by the cursor and stay valid until the next call of cursorNext(),
+   * cursorSeek() or cursorReset()
+   *
+   * @param[in] index Index of the entry in the current chunk
+   * @param[out] key Entry Key
+   * @param[out] data Entry Data
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t entryGet(const uint32_t &index,
+                               const BfRtTableKey **key,
+                               const BfRtTableData **data) const = 0;
+
+  /**
+   * @brief Get the number of key/data slots of the cursor, which is the
+   * maximum number of entries returned by one cursorNext()
+   *
+   * @param[out] chunk_size Number of slots
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t chunkSizeGet(uint32_t *chunk_size) const = 0;
+
+  /**
+   * @brief Check whether the end of the table has been reached
+   *
+   * @retval true if no more entries are left
+   * @retval false otherwise
+   */
+  virtual bool cursorEnd() const = 0;
+
+  /**
+   * @brief Get the key of the last entry returned by the cursor. Can be
+   * used to resume a walk on a newly allocated cursor with cursorSeek()
+   *
+   * @param[out] key Entry Key. Needs to be allocated from the same table
+   *
+   * @return Status of the API call. BF_OBJECT_NOT_FOUND if no entry was
+   * returned yet
+   */
+  virtual bf_status_t positionGet(BfRtTableKey *key) const = 0;
+
+  /**
+   * @brief Position the cursor so that the next chunk starts right after
+   * the entry specified by key
+   *
+   * @param[in] key Entry Key
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t cursorSeek(const BfRtTableKey &key) = 0;
+
+  /**
+   * @brief Position the cursor back on the first entry of the table
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t cursorReset() = 0;
+};
+
+}  // namespace bfrt
+
+#endif  // _BF_RT_TABLE_CURSOR_HPP
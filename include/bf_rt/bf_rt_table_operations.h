@@ -30,7 +30,20 @@ typedef enum bf_rt_table_operations_mode_ {
   /** Update sw value of all hit state o entries with the actual
      hw status. Applicable MATs with idletimeout POLL mode*/
   BFRT_HIT_STATUS_UPDATE = 2,
-  BFRT_INVALID
+  /** Kept at its original value, later types are numbered after it */
+  BFRT_INVALID = 3,
+  /** Same as BFRT_HIT_STATUS_UPDATE, and also report the entries whose
+     hit state changed since the previous update. Applicable MATs with
+     idletimeout POLL mode*/
+  BFRT_HIT_STATUS_DELTA = 4,
+  /** Same as BFRT_COUNTER_SYNC, and also report the counters which
+     changed since the previous sync along with their rates. Applicable on
+     Counters or MATs with direct counters */
+  BFRT_COUNTER_DELTA_SYNC = 5,
+  /** Same as BFRT_REGISTER_SYNC, and also copy all register cells into
+     the shared memory snapshot of the table. Applicable on Registers or
+     MATs with direct registers */
+  BFRT_REGISTER_SNAPSHOT_SYNC = 6
 } bf_rt_table_operations_mode_t;
 
 /**
@@ -47,6 +60,97 @@ typedef void (*bf_rt_register_sync_cb)(bf_rt_target_t *, void *);
  */
 typedef void (*bf_rt_counter_sync_cb)(bf_rt_target_t *, void *);
 
+/** Value of bf_rt_register_snapshot_hdr_t::magic */
+#define BF_RT_REGISTER_SNAPSHOT_MAGIC 0x42465253
+
+/**
+ * @brief Header at the start of a register snapshot. The snapshot is a
+ * POSIX shared memory object which other processes can map read only.
+ * The header is followed by one array of num_cells cells per pipe, pipe p
+ * starting at offset hdr_size + p * num_cells * cell_size. The fields of
+ * a cell are in the order of the register data fields in bf-rt.json, in
+ * host order, each one taking its width rounded up to 1, 2, 4 or 8 bytes.
+ * A sync stores the next odd version, issues a release fence
+ * (atomic_thread_fence(memory_order_release)) so that the odd value is
+ * visible before any cell write, writes the cells, and then makes version
+ * even again with a release store. A reader must access version
+ * atomically:
+ *   do {
+ *     v1 = __atomic_load_n(&hdr->version, __ATOMIC_ACQUIRE);
+ *     copy the cells;
+ *     __atomic_thread_fence(__ATOMIC_ACQUIRE);
+ *     v2 = __atomic_load_n(&hdr->version, __ATOMIC_RELAXED);
+ *   } while ((v1 & 1) || v1 != v2);
+ * The fence keeps the cell loads from moving after the second read of
+ * version. C11 and C++ readers can use atomic_load_explicit() and
+ * atomic_thread_fence() on an _Atomic or std::atomic view of version
+ * instead.
+ */
+typedef struct bf_rt_register_snapshot_hdr_ {
+  /** BF_RT_REGISTER_SNAPSHOT_MAGIC */
+  uint32_t magic;
+  /** Size of the header in bytes */
+  uint32_t hdr_size;
+  /** Sync sequence number, odd while a sync is in progress. Only
+   * accessed with atomic loads and stores */
+  uint64_t version;
+  /** CLOCK_MONOTONIC time of the last completed sync in nanoseconds */
+  uint64_t sync_time_ns;
+  /** Table ID of the register table */
+  uint32_t table_id;
+  /** Number of pipes in the snapshot */
+  uint32_t num_pipes;
+  /** Number of cells per pipe */
+  uint32_t num_cells;
+  /** Size of a cell in bytes */
+  uint32_t cell_size;
+} bf_rt_register_snapshot_hdr_t;
+
+/**
+ * @brief Register Snapshot Sync Callback
+ * @param[in] dev_tgt Device target
+ * @param[in] version Snapshot version written by the sync
+ * @param[in] cookie User registered optional cookie
+ */
+typedef void (*bf_rt_register_snapshot_sync_cb)(bf_rt_target_t *,
+                                                uint64_t,
+                                                void *);
+
+/**
+ * @brief Counter delta reported by a counter delta sync
+ */
+typedef struct bf_rt_counter_delta_ {
+  /** Counter index for Counter tables, entry handle for MATs */
+  uint32_t index;
+  /** Packet count after the sync */
+  uint64_t packets;
+  /** Byte count after the sync */
+  uint64_t bytes;
+  /** Packets counted since the previous sync */
+  uint64_t delta_packets;
+  /** Bytes counted since the previous sync */
+  uint64_t delta_bytes;
+  /** Moving average of the packet rate in packets per second */
+  double packet_rate;
+  /** Moving average of the byte rate in bytes per second */
+  double byte_rate;
+} bf_rt_counter_delta_t;
+
+/**
+ * @brief Counter Delta Sync Callback. The array is only valid for the
+ * duration of the callback
+ * @param[in] dev_tgt Device target
+ * @param[in] deltas Counters which changed since the previous sync
+ * @param[in] num_deltas Number of counters in deltas
+ * @param[in] interval_us Time since the previous sync in microseconds
+ * @param[in] cookie User registered optional cookie
+ */
+typedef void (*bf_rt_counter_delta_sync_cb)(bf_rt_target_t *,
+                                            const bf_rt_counter_delta_t *,
+                                            uint32_t,
+                                            uint64_t,
+                                            void *);
+
 /**
  * @brief Hit State Update Callback
  * @param[in] dev_tgt Device target
@@ -54,6 +158,23 @@ typedef void (*bf_rt_counter_sync_cb)(bf_rt_target_t *, void *);
  */
 typedef void (*bf_rt_hit_state_update_cb)(bf_rt_target_t *, void *);
 
+/**
+ * @brief Hit State Delta Callback. The arrays are only valid for the
+ * duration of the callback
+ * @param[in] dev_tgt Device target
+ * @param[in] active_hdls Handles of the entries which became active
+ * @param[in] num_active Number of entries in active_hdls
+ * @param[in] idle_hdls Handles of the entries which became idle
+ * @param[in] num_idle Number of entries in idle_hdls
+ * @param[in] cookie User registered optional cookie
+ */
+typedef void (*bf_rt_hit_state_delta_cb)(bf_rt_target_t *,
+                                         const bf_rt_handle_t *,
+                                         uint32_t,
+                                         const bf_rt_handle_t *,
+                                         uint32_t,
+                                         void *);
+
 /**
  * @brief Set Register sync callback.
  *
@@ -72,6 +193,26 @@ bf_status_t bf_rt_operations_register_sync_set(
     const bf_rt_register_sync_cb callback,
     const void *cookie);
 
+/**
+ * @brief Set Register snapshot sync callback. Register cells are synced
+ * from hw and copied into the shared memory snapshot of the table, see
+ * bf_rt_table_register_snapshot_get().
+ *
+ * @param[in] tbl_ops Table operations handle
+ * @param[in] session Session Object
+ * @param[in] dev_tgt Device target
+ * @param[in] callback Register snapshot sync callback
+ * @param[in] cookie User cookie
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_operations_register_snapshot_sync_set(
+    bf_rt_table_operations_hdl *tbl_ops,
+    const bf_rt_session_hdl *session,
+    const bf_rt_target_t *dev_tgt,
+    const bf_rt_register_snapshot_sync_cb callback,
+    const void *cookie);
+
 /**
  * @brief Set Counter sync callback.
  *
@@ -90,6 +231,28 @@ bf_status_t bf_rt_operations_counter_sync_set(
     const bf_rt_counter_sync_cb callback,
     const void *cookie);
 
+/**
+ * @brief Set Counter delta sync callback. Counters are synced into a
+ * double buffer and only the ones which changed since the previous sync
+ * are passed to the callback, with moving average rates.
+ *
+ * @param[in] tbl_ops Table operations handle
+ * @param[in] session Session Object
+ * @param[in] dev_tgt Device target
+ * @param[in] ewma_alpha Weight of the latest interval in the rates (0, 1]
+ * @param[in] callback Counter delta sync callback
+ * @param[in] cookie User cookie
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_operations_counter_delta_sync_set(
+    bf_rt_table_operations_hdl *tbl_ops,
+    const bf_rt_session_hdl *session,
+    const bf_rt_target_t *dev_tgt,
+    const double ewma_alpha,
+    const bf_rt_counter_delta_sync_cb callback,
+    const void *cookie);
+
 /**
  * @brief Set Hit State Update callback.
  *
@@ -108,6 +271,26 @@ bf_status_t bf_rt_operations_hit_state_update_set(
     const bf_rt_hit_state_update_cb callback,
     const void *cookie);
 
+/**
+ * @brief Set Hit State Delta callback. The hit state of all entries is
+ * updated and the entries whose state changed since the previous update
+ * are passed to the callback.
+ *
+ * @param[in] tbl_ops Table operations handle
+ * @param[in] session Session Object
+ * @param[in] dev_tgt Device target
+ * @param[in] callback Hit State delta callback
+ * @param[in] cookie User cookie
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_operations_hit_state_delta_set(
+    bf_rt_table_operations_hdl *tbl_ops,
+    const bf_rt_session_hdl *session,
+    const bf_rt_target_t *dev_tgt,
+    const bf_rt_hit_state_delta_cb callback,
+    const void *cookie);
+
 #ifdef __cplusplus
 }
 #endif
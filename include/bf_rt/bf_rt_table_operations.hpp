@@ -20,6 +20,7 @@
 #include <functional>
 
 #include <bf_rt/bf_rt_common.h>
+#include <bf_rt/bf_rt_table_operations.h>
 #include <bf_rt/bf_rt_session.hpp>
 
 namespace bfrt {
@@ -37,7 +38,20 @@ enum class TableOperationsType {
   /** Update sw value of all hit state o entries with the actual
      hw status. Applicable MATs with idletimeout POLL mode*/
   HIT_STATUS_UPDATE = 2,
-  INVALID = 3
+  /** Kept at its original value, later types are numbered after it */
+  INVALID = 3,
+  /** Same as HIT_STATUS_UPDATE, and also report the entries whose hit
+     state changed since the previous update. Applicable MATs with
+     idletimeout POLL mode*/
+  HIT_STATUS_DELTA = 4,
+  /** Same as COUNTER_SYNC, and also report the counters which changed
+     since the previous sync along with their rates. Applicable on
+     Counters or MATs with direct counters */
+  COUNTER_DELTA_SYNC = 5,
+  /** Same as REGISTER_SYNC, and also copy all register cells into the
+     shared memory snapshot of the table. Applicable on Registers or
+     MATs with direct registers */
+  REGISTER_SNAPSHOT_SYNC = 6
 };
 
 /**
@@ -48,6 +62,16 @@ enum class TableOperationsType {
 typedef std::function<void(const bf_rt_target_t &dev_tgt, void *cookie)>
     BfRtRegisterSyncCb;
 
+/**
+ * @brief Register Snapshot Sync Callback
+ * @param[in] dev_tgt Device target
+ * @param[in] version Snapshot version written by the sync
+ * @param[in] cookie User registered optional cookie
+ */
+typedef std::function<void(
+    const bf_rt_target_t &dev_tgt, const uint64_t &version, void *cookie)>
+    BfRtRegisterSnapshotSyncCb;
+
 /**
  * @brief Counter Sync Callback
  * @param[in] dev_tgt Device target
@@ -56,6 +80,42 @@ typedef std::function<void(const bf_rt_target_t &dev_tgt, void *cookie)>
 typedef std::function<void(const bf_rt_target_t &dev_tgt, void *cookie)>
     BfRtCounterSyncCb;
 
+/**
+ * @brief Counter delta reported by a counter delta sync
+ */
+struct BfRtCounterDelta {
+  /** Counter index for Counter tables, entry handle for MATs */
+  uint32_t index;
+  /** Packet count after the sync */
+  uint64_t packets;
+  /** Byte count after the sync */
+  uint64_t bytes;
+  /** Packets counted since the previous sync */
+  uint64_t delta_packets;
+  /** Bytes counted since the previous sync */
+  uint64_t delta_bytes;
+  /** Moving average of the packet rate in packets per second */
+  double packet_rate;
+  /** Moving average of the byte rate in bytes per second */
+  double byte_rate;
+};
+
+/**
+ * @brief Counter Delta Sync Callback. The array is only valid for the
+ * duration of the callback
+ * @param[in] dev_tgt Device target
+ * @param[in] deltas Counters which changed since the previous sync
+ * @param[in] num_deltas Number of counters in deltas
+ * @param[in] interval_us Time since the previous sync in microseconds
+ * @param[in] cookie User registered optional cookie
+ */
+typedef std::function<void(const bf_rt_target_t &dev_tgt,
+                           const BfRtCounterDelta *deltas,
+                           const uint32_t &num_deltas,
+                           const uint64_t &interval_us,
+                           void *cookie)>
+    BfRtCounterDeltaSyncCb;
+
 /**
  * @brief Hit State Update Callback
  * @param[in] dev_tgt Device target
@@ -64,6 +124,26 @@ typedef std::function<void(const bf_rt_target_t &dev_tgt, void *cookie)>
 typedef std::function<void(const bf_rt_target_t &dev_tgt, void *cookie)>
     BfRtHitStateUpdateCb;
 
+/**
+ * @brief Hit State Delta Callback. The arrays are only valid for the
+ * duration of the callback
+ * @param[in] dev_tgt Device target
+ * @param[in] active_hdls Handles of the entries which were hit since the
+ * previous update after having been idle
+ * @param[in] num_active Number of entries in active_hdls
+ * @param[in] idle_hdls Handles of the entries which were not hit since the
+ * previous update after having been active
+ * @param[in] num_idle Number of entries in idle_hdls
+ * @param[in] cookie User registered optional cookie
+ */
+typedef std::function<void(const bf_rt_target_t &dev_tgt,
+                           const bf_rt_handle_t *active_hdls,
+                           const uint32_t &num_active,
+                           const bf_rt_handle_t *idle_hdls,
+                           const uint32_t &num_idle,
+                           void *cookie)>
+    BfRtHitStateDeltaCb;
+
 /**
  * @brief Class to construct Operations Object<br>
  * <B>Creation: </B> Can only be created using \ref
@@ -89,6 +169,28 @@ class BfRtTableOperations {
                                       const BfRtRegisterSyncCb &callback,
                                       const void *cookie) = 0;
 
+  /**
+   * @brief Set Register snapshot sync callback. The register cells are
+   * synced like with registerSyncSet() and then copied, for all pipes in
+   * dev_tgt, into the shared memory snapshot of the table. The snapshot
+   * layout is described by bf_rt_register_snapshot_hdr_t and its name is
+   * given by BfRtTable::tableRegisterSnapshotGet(), so that other
+   * processes can read the cells without going through tableEntryGet().
+   * Works on Match Action tables and register tables only
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] callback Register snapshot sync callback
+   * @param[in] cookie User cookie
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t registerSnapshotSyncSet(
+      const BfRtSession &session,
+      const bf_rt_target_t &dev_tgt,
+      const BfRtRegisterSnapshotSyncCb &callback,
+      const void *cookie) = 0;
+
   /**
    * @brief Set Counter sync callback.
    * Works on Match Action tables and counter tables only
@@ -105,6 +207,32 @@ class BfRtTableOperations {
                                      const BfRtCounterSyncCb &callback,
                                      const void *cookie) = 0;
 
+  /**
+   * @brief Set Counter delta sync callback. The counters are read from hw
+   * like with counterSyncSet() into one of two buffers, while the other
+   * buffer holds the values of the previous sync, so readers of the sw
+   * values are never blocked by the DMA. Only the counters whose value
+   * changed since the previous sync are passed to the callback. The rates
+   * are exponentially weighted moving averages:
+   * rate = ewma_alpha * delta / interval + (1 - ewma_alpha) * rate.
+   * Works on Match Action tables and counter tables only
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] ewma_alpha Weight of the latest interval in the rates,
+   * in the range (0, 1]. 1 gives the rate of the latest interval only
+   * @param[in] callback Counter delta sync callback
+   * @param[in] cookie User cookie
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t counterDeltaSyncSet(
+      const BfRtSession &session,
+      const bf_rt_target_t &dev_tgt,
+      const double &ewma_alpha,
+      const BfRtCounterDeltaSyncCb &callback,
+      const void *cookie) = 0;
+
   /**
    * @brief Set Hit State Update callback.
    * Works on Match Action tables only
@@ -120,6 +248,26 @@ class BfRtTableOperations {
                                         const bf_rt_target_t &dev_tgt,
                                         const BfRtHitStateUpdateCb &callback,
                                         const void *cookie) = 0;
+
+  /**
+   * @brief Set Hit State Delta callback. The hit state of all entries is
+   * updated like with hitStateUpdateSet() and the entries whose state
+   * changed are compared against the previous update, so the caller does
+   * not have to walk the table to find newly idle or newly active entries.
+   * The first update after enabling poll mode reports every hit entry.
+   * Works on Match Action tables only
+   *
+   * @param[in] session Session Object
+   * @param[in] dev_tgt Device target
+   * @param[in] callback Hit State delta callback
+   * @param[in] cookie User cookie
+   *
+   * @return Status of the API call
+   */
+  virtual bf_status_t hitStateDeltaSet(const BfRtSession &session,
+                                       const bf_rt_target_t &dev_tgt,
+                                       const BfRtHitStateDeltaCb &callback,
+                                       const void *cookie) = 0;
 };
 }  // namespace bfrt
 
@@ -0,0 +1,185 @@
+/* 
+ * Copyright (c) Intel Corporation
+ * SPDX-License-Identifier: CC-BY-ND-4.0
+ */
+
+
+/** @file bf_rt_table_packed.hpp
+ *
+ *  @brief Contains BF-RT helpers for tables programmed through the packed
+ *  layout
+ *
+ *  The packed layout of a table is derived from its bf-rt.json description
+ *  as follows. All the values are in network order.
+ *
+ *  Key buffer: the key fields in bf-rt.json order. Every field takes
+ *  ceil(width / 8) bytes, where the width of uint8/16/32/64 is 8/16/32/64
+ *  and the width of bytes is given by its "width" in bits.
+ *    - Exact: value
+ *    - Ternary: value, then mask
+ *    - Range: start, then end
+ *    - LPM: value, then a 2 byte prefix length
+ *    - Optional: value, then a 1 byte is_valid
+ *
+ *  Data buffer: the fields of the action (if the table has actions) in
+ *  bf-rt.json order, followed by the common data fields of the table. Every
+ *  field takes the same number of bytes as a key value, bool takes 1 byte,
+ *  float takes 4 bytes (IEEE-754) and a string with a list of choices takes
+ *  a 4 byte index into that list. Tables with other data fields (free
+ *  strings, repeated fields, containers, oneof) have no packed layout.
+ *
+ *  Layout ID: 64 bit FNV-1a hash of the text "T<table_id>;" followed by
+ *  "K<field_id>:<match_type>:<bytes>;" for every key field, then for every
+ *  action "A<action_id>;" followed by "D<field_id>:<bytes>;" for every field
+ *  of the action, and finally "D<field_id>:<bytes>;" for every common data
+ *  field. <bytes> is the size of the value of the field, <match_type> is the
+ *  bf-rt.json match_type string. The same hash is computed by the driver from
+ *  the bf-rt.json it loaded, so structs generated for another version of the
+ *  program are rejected instead of being misinterpreted.
+ *
+ *  Structs following this layout are emitted by
+ *  share/bf_rt_shared/bf_rt_typed_gen.py.
+ */
+#ifndef _BF_RT_TABLE_PACKED_HPP
+#define _BF_RT_TABLE_PACKED_HPP
+
+#include <cstdint>
+#include <cstring>
+
+#include <bf_rt/bf_rt_common.h>
+#include <bf_rt/bf_rt_session.hpp>
+#include <bf_rt/bf_rt_table.hpp>
+
+namespace bfrt {
+namespace packed {
+
+/**
+ * @brief Write a value of up to 64 bits in network order
+ *
+ * @param[out] dst Start of the field in the packed buffer
+ * @param[in] size Number of bytes of the field
+ * @param[in] value Value
+ */
+inline void fieldSet(uint8_t *dst, const size_t &size, const uint64_t &value) {
+  for (size_t i = 0; i < size; i++) {
+    dst[size - 1 - i] = (i < sizeof(value)) ? (value >> (8 * i)) & 0xff : 0;
+  }
+}
+
+/**
+ * @brief Read a value of up to 64 bits in network order
+ *
+ * @param[in] src Start of the field in the packed buffer
+ * @param[in] size Number of bytes of the field
+ *
+ * @returns Value of the field
+ */
+inline uint64_t fieldGet(const uint8_t *src, const size_t &size) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; i++) {
+    value = (value << 8) | src[i];
+  }
+  return value;
+}
+
+/**
+ * @brief Write a byte-array field. The input needs to be in network order
+ * and of the size of the field
+ */
+inline void fieldSet(uint8_t *dst, const size_t &size, const uint8_t *value) {
+  std::memcpy(dst, value, size);
+}
+
+/**
+ * @brief Write a float field
+ */
+inline void fieldSetFloat(uint8_t *dst, const float &value) {
+  uint32_t raw;
+  static_assert(sizeof(raw) == sizeof(value), "Unexpected float size");
+  std::memcpy(&raw, &value, sizeof(raw));
+  fieldSet(dst, sizeof(raw), raw);
+}
+
+/**
+ * @brief Read a float field
+ */
+inline float fieldGetFloat(const uint8_t *src) {
+  uint32_t raw = static_cast<uint32_t>(fieldGet(src, sizeof(raw)));
+  float value;
+  std::memcpy(&value, &raw, sizeof(value));
+  return value;
+}
+
+/**
+ * @brief Add an entry described by generated typed Key and Data structs
+ */
+template <typename Key, typename Data>
+inline bf_status_t tableEntryAdd(const BfRtTable &table,
+                                 const BfRtSession &session,
+                                 const bf_rt_target_t &dev_tgt,
+                                 const uint64_t &flags,
+                                 const Key &key,
+                                 const Data &data) {
+  static_assert(Key::kLayoutId == Data::kLayoutId,
+                "Key and Data belong to different tables");
+  const uint64_t layout_id = Key::kLayoutId;
+  const bf_rt_id_t action_id = Data::kActionId;
+  const size_t key_size = Key::kSize;
+  const size_t data_size = Data::kSize;
+  return table.tableEntryAddPacked(session,
+                                   dev_tgt,
+                                   flags,
+                                   layout_id,
+                                   key.bytes,
+                                   key_size,
+                                   action_id,
+                                   data.bytes,
+                                   data_size);
+}
+
+/**
+ * @brief Modify an entry described by generated typed Key and Data structs
+ */
+template <typename Key, typename Data>
+inline bf_status_t tableEntryMod(const BfRtTable &table,
+                                 const BfRtSession &session,
+                                 const bf_rt_target_t &dev_tgt,
+                                 const uint64_t &flags,
+                                 const Key &key,
+                                 const Data &data) {
+  static_assert(Key::kLayoutId == Data::kLayoutId,
+                "Key and Data belong to different tables");
+  const uint64_t layout_id = Key::kLayoutId;
+  const bf_rt_id_t action_id = Data::kActionId;
+  const size_t key_size = Key::kSize;
+  const size_t data_size = Data::kSize;
+  return table.tableEntryModPacked(session,
+                                   dev_tgt,
+                                   flags,
+                                   layout_id,
+                                   key.bytes,
+                                   key_size,
+                                   action_id,
+                                   data.bytes,
+                                   data_size);
+}
+
+/**
+ * @brief Delete an entry described by a generated typed Key struct
+ */
+template <typename Key>
+inline bf_status_t tableEntryDel(const BfRtTable &table,
+                                 const BfRtSession &session,
+                                 const bf_rt_target_t &dev_tgt,
+                                 const uint64_t &flags,
+                                 const Key &key) {
+  const uint64_t layout_id = Key::kLayoutId;
+  const size_t key_size = Key::kSize;
+  return table.tableEntryDelPacked(
+      session, dev_tgt, flags, layout_id, key.bytes, key_size);
+}
+
+}  // namespace packed
+}  // namespace bfrt
+
+#endif  // _BF_RT_TABLE_PACKED_HPP
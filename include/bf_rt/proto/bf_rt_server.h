@@ -10,10 +10,63 @@
 #ifndef _BF_RT_SERVER_H
 #define _BF_RT_SERVER_H
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <bf_types/bf_types.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Number of buckets of a RPC latency histogram */
+#define BF_RT_GRPC_LATENCY_BUCKETS 24
+
+/**
+ * @brief RPCs of the BfRuntime service
+ */
+typedef enum bf_rt_grpc_rpc_type_e {
+  BF_RT_GRPC_RPC_WRITE = 0,
+  BF_RT_GRPC_RPC_READ,
+  BF_RT_GRPC_RPC_SET_FWD_PIPELINE_CONFIG,
+  BF_RT_GRPC_RPC_GET_FWD_PIPELINE_CONFIG,
+  BF_RT_GRPC_RPC_MAX
+} bf_rt_grpc_rpc_type_t;
+
+/**
+ * @brief Server configuration
+ */
+typedef struct bf_rt_grpc_server_cfg_s {
+  const char *program_name;   /** P4 program name to use */
+  const char *server_address; /** ip:port to bind to, NULL for the default
+                                  address (0.0.0.0:50052) */
+  bool local_only;            /** Bind to the local loopback interface only
+                                  when server_address is NULL */
+  uint32_t num_cqs;           /** Number of completion queues, 0 for one
+                                  per worker thread */
+  uint32_t num_workers;       /** Number of worker threads handling RPCs,
+                                  0 for the number of online CPUs */
+  uint32_t read_chunk_entities; /** Default max number of entities per
+                                    ReadResponse, 0 for 1024 */
+  uint32_t read_chunk_bytes;  /** Default max size of a ReadResponse in
+                                  bytes, 0 for 1MB */
+  uint32_t num_stream_senders; /** Number of threads sending queued
+                                   notifications to clients, 0 for 1 */
+  uint32_t digest_queue_depth; /** Default max number of DigestLists queued
+                                   per client, 0 for 1024 */
+} bf_rt_grpc_server_cfg_t;
+
+/**
+ * @brief Latency histogram of a RPC. Bucket i counts the RPCs which
+ * completed in less than 2^i microseconds and not in a lower bucket, the
+ * last bucket counts everything slower.
+ */
+typedef struct bf_rt_grpc_latency_hist_s {
+  uint64_t count;                               /** Number of RPCs */
+  uint64_t sum_us;                              /** Sum of the latencies */
+  uint64_t max_us;                              /** Highest latency */
+  uint64_t bucket[BF_RT_GRPC_LATENCY_BUCKETS];  /** Latency buckets */
+} bf_rt_grpc_latency_hist_t;
+
 /**
  * @brief Start server and bind to default address (0.0.0.0:50052)
  *
@@ -31,6 +84,41 @@ void bf_rt_grpc_server_run(const char *program_name, bool local_only);
  */
 void bf_rt_grpc_server_run_with_addr(const char *server_address);
 
+/**
+ * @brief Start an asynchronous server. RPCs are taken off gRPC completion
+ * queues and handled by a pool of worker threads. Write and Read RPCs
+ * only lock the tables they access, so a Read with GET_FROM_SW runs
+ * concurrently with Writes to other tables. Writes to the same table are
+ * applied in the order they were received.
+ * The call does not block: it returns once the server is listening and
+ * the worker threads are started, or with an error if the address cannot
+ * be bound.
+ *
+ * @param[in] cfg               Server configuration
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_grpc_server_run_with_cfg(const bf_rt_grpc_server_cfg_t *cfg);
+
+/**
+ * @brief Get the latency histogram of a RPC, measured from the time the
+ * RPC is taken off the completion queue until its response is queued
+ *
+ * @param[in] rpc               RPC type
+ * @param[out] hist             Latency histogram
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_grpc_server_latency_get(bf_rt_grpc_rpc_type_t rpc,
+                                          bf_rt_grpc_latency_hist_t *hist);
+
+/**
+ * @brief Clear the latency histograms of all RPCs
+ *
+ * @return Status of the API call
+ */
+bf_status_t bf_rt_grpc_server_latency_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -51,6 +51,9 @@ typedef struct bf_dma_bufpool_info_s {
   bf_sys_dma_pool_handle_t dma_buf_pool_handle;
   unsigned int dma_buf_size;
   unsigned int dma_buf_cnt;
+  bf_dma_page_size_t dma_buf_page_size;
+  int dma_buf_numa_node;        // only meaningful if dma_buf_numa_node_valid
+  bool dma_buf_numa_node_valid; // set by bf_dma_pools_create()
 } bf_dma_buf_info_t;
 
 typedef struct bf_dma_info_s {
@@ -213,6 +216,73 @@ static inline unsigned int bf_dma_get_buf_cnt(bf_dma_info_t *dma_info,
   return (dma_info->dma_buff_info[dma_type].dma_buf_cnt);
 }
 
+/**
+ * @brief Get the page size backing the dma buffer pool associated with a DR
+ *
+ * @param[in] dma_info Pointer to DMA info
+ * @param[in] dma_type Type of DMA
+ *
+ * @return DMA buffer page size
+ */
+static inline bf_dma_page_size_t bf_dma_get_buf_page_size(
+    bf_dma_info_t *dma_info, bf_dma_type_t dma_type) {
+  if (!dma_info || dma_type >= BF_DMA_TYPE_MAX) {
+    return BF_DMA_PAGE_SIZE_DEFAULT;
+  }
+  return (dma_info->dma_buff_info[dma_type].dma_buf_page_size);
+}
+
+/**
+ * @brief Get the NUMA node of the dma buffer pool associated with a DR
+ *
+ * @param[in] dma_info Pointer to DMA info
+ * @param[in] dma_type Type of DMA
+ *
+ * @return NUMA node of the DMA buffer pool, -1 if unknown
+ */
+static inline int bf_dma_get_buf_numa_node(bf_dma_info_t *dma_info,
+                                           bf_dma_type_t dma_type) {
+  if (!dma_info || dma_type >= BF_DMA_TYPE_MAX ||
+      !dma_info->dma_buff_info[dma_type].dma_buf_numa_node_valid) {
+    return -1;
+  }
+  return (dma_info->dma_buff_info[dma_type].dma_buf_numa_node);
+}
+
+#ifndef __KERNEL__
+/**
+ * @brief Create the DR and buffer pools of a device as described by a DMA
+ * profile and fill in dma_info accordingly, ready to be passed to
+ * bf_device_add(). Pools are carved out of 2M or 1G hugepages when requested
+ * and allocated on the requested NUMA node, so that large rings are covered
+ * by few IOTLB entries. Every bf_dma_type_t without an explicit size in the
+ * profile gets the default size of the device family.
+ *
+ * @param[in] dev_family The type of device, e.g. BF_DEV_FAMILY_TOFINO
+ * @param[in] dev_id The ASIC id.
+ * @param[in] subdev_id Subdevice id within the ASIC.
+ * @param[in] dma_prof DMA profile, usually the dma_prof of the device profile
+ * @param[out] dma_info DMA info filled in with the created pools
+ *
+ * @return Status of the API call. BF_NO_SYS_RESOURCES if not enough pages of
+ * the requested size are available on the requested node.
+ */
+bf_status_t bf_dma_pools_create(bf_dev_family_t dev_family,
+                                bf_dev_id_t dev_id,
+                                bf_subdev_id_t subdev_id,
+                                const bf_dma_profile_t *dma_prof,
+                                bf_dma_info_t *dma_info);
+
+/**
+ * @brief Destroy the pools created by bf_dma_pools_create()
+ *
+ * @param[in] dma_info DMA info filled in by bf_dma_pools_create()
+ *
+ * @return Status of the API call.
+ */
+bf_status_t bf_dma_pools_destroy(bf_dma_info_t *dma_info);
+#endif
+
 /**
  * @brief Initialize device mgr
  *
@@ -245,6 +315,14 @@ bf_status_t bf_pktmgr_device_add(bf_dev_family_t dev_family,
  * @param[in] dma_info Information regarding DMA DRs and associated buffer pools
  * @param[in] flags Device related flags passed by application to drivers
  *
+ * The DRs and pools described by dma_info are always the ones used, the
+ * dma_prof of the profile is only an input to bf_dma_pools_create(). When
+ * dma_prof is not all zero, the page size and NUMA node recorded in
+ * dma_info for every pool must match it, otherwise the call fails with
+ * BF_INVALID_ARG instead of ignoring the profile. A pool whose page size
+ * is BF_DMA_PAGE_SIZE_DEFAULT or whose NUMA node is not valid, as in a
+ * zero initialized dma_info, is not checked.
+ *
  * @return Status of the API call.
  */
 bf_status_t bf_device_add(bf_dev_family_t dev_family,
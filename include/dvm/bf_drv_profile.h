@@ -11,6 +11,7 @@
 #include <bf_types/bf_kernel_types.h>
 #endif
 #include <bf_types/bf_types.h>
+#include <dvm/bf_dma_types.h>
 
 #define DEF_PROFILE_INDEX 0
 #define DEF_PROGRAM_INDEX 0
@@ -57,8 +58,38 @@ typedef struct bf_p4_program {
   char *bfrt_json_file;  // bf-rt info json file
   uint8_t num_p4_pipelines;
   bf_p4_pipeline_t p4_pipelines[MAX_P4_PIPELINES];
+  char *bfrt_cache_file;  // pre-parsed bf-rt info cache file, NULL disables
 } bf_p4_program_t;
 
+/* Page size backing a DMA pool */
+typedef enum bf_dma_page_size_e {
+  BF_DMA_PAGE_SIZE_DEFAULT = 0,  // platform default
+  BF_DMA_PAGE_SIZE_4K,
+  BF_DMA_PAGE_SIZE_2M,
+  BF_DMA_PAGE_SIZE_1G
+} bf_dma_page_size_t;
+
+/* NUMA placement of the DMA pools */
+typedef enum bf_dma_numa_policy_e {
+  BF_DMA_NUMA_DEFAULT = 0,   // platform default
+  BF_DMA_NUMA_DEVICE_LOCAL,  // node the device is attached to
+  BF_DMA_NUMA_NODE           // node given by numa_node
+} bf_dma_numa_policy_t;
+
+/* Sizing of the DR and buffer pool of one bf_dma_type_t, 0 means default */
+typedef struct bf_dma_pool_profile {
+  unsigned int dr_entry_count[BF_DMA_DR_DIRS];  // descriptors per direction
+  unsigned int buf_size;                        // bytes per buffer
+  unsigned int buf_cnt;                         // number of buffers
+} bf_dma_pool_profile_t;
+
+typedef struct bf_dma_profile {
+  bf_dma_page_size_t page_size;
+  bf_dma_numa_policy_t numa_policy;
+  int numa_node;  // only used with BF_DMA_NUMA_NODE
+  bf_dma_pool_profile_t pools[BF_DMA_TYPE_MAX];
+} bf_dma_profile_t;
+
 typedef struct bf_device_profile {
   uint8_t num_p4_programs;
   bf_p4_program_t p4_programs[MAX_PROGRAMS_PER_DEVICE];
@@ -66,6 +97,8 @@ typedef struct bf_device_profile {
   microp_fw_profile_t microp_prof;
   char *bfrt_non_p4_json_dir_path;  // bfrt fixed feature info json files path
   char *tdi_non_p4_json_dir_path;   //  tdi fixed feature info json files path
+  bf_dma_profile_t dma_prof;        // DMA pool backing and sizing, input
+                                    // to bf_dma_pools_create()
 } bf_device_profile_t;
 
 /* @} */
@@ -84,6 +84,35 @@ bf_status_t bf_mc_mgrp_create(bf_mc_session_hdl_t shdl,
                               bf_mc_grp_id_t grp,
                               bf_mc_mgrp_hdl_t *hdl);
 
+/**
+ * Create many multicast groups along with their nodes in one call.  The
+ * L1 and L2 node layout and the RDM memory of all the groups are computed
+ * up front, before anything is written, and the result is pushed to the
+ * hardware in large DMA batches instead of node by node.  Either all the
+ * groups are created or, on error, none of them.  The created groups and
+ * nodes can be managed with the other APIs as if they had been built with
+ * bf_mc_mgrp_create(), bf_mc_node_create() and bf_mc_associate_node().
+ * @param shdl Session handle.
+ * @param dev The ASIC id.
+ * @param grp_count Number of groups to create.
+ * @param grps Array of grp_count group descriptions.
+ * @param mgrp_hdls Array with space for grp_count group handles which will
+ *                  be returned.
+ * @param node_hdls Array with space for the node_count of all the groups
+ *                  which will be filled with the node handles, group after
+ *                  group in the order of the descriptions.
+ * @param failed_idx If not NULL, filled with the index of the group which
+ *                   caused the error.
+ * @return Status of the API call.
+ */
+bf_status_t bf_mc_mgrp_bulk_create(bf_mc_session_hdl_t shdl,
+                                   bf_dev_id_t dev,
+                                   uint32_t grp_count,
+                                   const bf_mc_mgrp_desc_t *grps,
+                                   bf_mc_mgrp_hdl_t *mgrp_hdls,
+                                   bf_mc_node_hdl_t *node_hdls,
+                                   uint32_t *failed_idx);
+
 /**
  * Get a multicast group's attributes.
  * @param shdl Session handle.
@@ -409,6 +438,60 @@ bf_status_t bf_mc_node_update(bf_mc_session_hdl_t shdl,
                               bf_mc_port_map_t port_map,
                               bf_mc_lag_map_t lag_map);
 
+/**
+ * Apply membership changes to many nodes in one call.  Each change adds and
+ * removes ports and LAGs relative to the current membership of the node
+ * instead of replacing it.  The changes of all the nodes are merged first
+ * and only the RDM entries whose content changes are rewritten; a node
+ * whose membership ends up unchanged is not touched.  A port or LAG which
+ * is both added and removed for the same node is removed.  Either all the
+ * changes are applied or, on error, none of them.
+ * @param shdl Session handle.
+ * @param dev The ASIC id.
+ * @param count Number of changes.
+ * @param deltas Array of count membership changes.
+ * @param failed_idx If not NULL, filled with the index of the change which
+ *                   caused the error.
+ * @return Status of the API call.
+ */
+bf_status_t bf_mc_node_update_delta(bf_mc_session_hdl_t shdl,
+                                    bf_dev_id_t dev,
+                                    uint32_t count,
+                                    const bf_mc_node_delta_t *deltas,
+                                    uint32_t *failed_idx);
+
+/**
+ * Enable or disable sharing of L2 port and LAG node chains.  When enabled,
+ * nodes with the same RID, port map and LAG map, in any group, point to a
+ * single reference counted copy of the L2 chain in the RDM instead of
+ * each having its own.  A change to one of these nodes gives it a private
+ * copy of the chain, or makes it share another existing one.
+ * @param shdl Session handle.
+ * @param dev The ASIC id.
+ * @param enable Whether to share L2 chains.
+ * @return Status of the API call.
+ */
+bf_status_t bf_mc_set_l2_chain_sharing(bf_mc_session_hdl_t shdl,
+                                       bf_dev_id_t dev,
+                                       bool enable);
+
+/**
+ * Get the L2 node chain sharing state and usage.
+ * @param shdl Session handle.
+ * @param dev The ASIC id.
+ * @param enable Pointer to a bool filled with the sharing state.
+ * @param shared_chains Pointer filled with the number of L2 chains used by
+ *                      more than one node.
+ * @param rdm_lines_saved Pointer filled with the number of RDM lines saved
+ *                        by sharing.
+ * @return Status of the API call.
+ */
+bf_status_t bf_mc_get_l2_chain_sharing(bf_mc_session_hdl_t shdl,
+                                       bf_dev_id_t dev,
+                                       bool *enable,
+                                       uint32_t *shared_chains,
+                                       uint32_t *rdm_lines_saved);
+
 /**
  * Create an ECMP group.
  * @param shdl Session handle.
@@ -147,6 +147,31 @@ typedef uint8_t bf_mc_lag_id_t;
     v = ((*_MC_pm)[_MC_i] >> _MC_j) & 1; \
   } while (0);
 
+/** Describes one node of a multicast group for bf_mc_mgrp_bulk_create(). */
+typedef struct bf_mc_node_desc_t {
+  bf_mc_rid_t rid;           /**< RID of the node. */
+  bool l1_xid_valid;         /**< Whether the node has an L1 exclusion id. */
+  bf_mc_l1_xid_t l1_xid;     /**< L1 exclusion id of the node. */
+  bf_mc_port_map_t port_map; /**< Member ports of the node. */
+  bf_mc_lag_map_t lag_map;   /**< Member LAGs of the node. */
+} bf_mc_node_desc_t;
+
+/** Describes a multicast group for bf_mc_mgrp_bulk_create(). */
+typedef struct bf_mc_mgrp_desc_t {
+  bf_mc_grp_id_t grp;             /**< Multicast group id. */
+  uint32_t node_count;            /**< Number of entries in nodes. */
+  const bf_mc_node_desc_t *nodes; /**< Nodes of the group. */
+} bf_mc_mgrp_desc_t;
+
+/** Describes a membership change of a node for bf_mc_node_update_delta(). */
+typedef struct bf_mc_node_delta_t {
+  bf_mc_node_hdl_t node_hdl;  /**< Node to update. */
+  bf_mc_port_map_t add_ports; /**< Ports to add to the node. */
+  bf_mc_port_map_t rem_ports; /**< Ports to remove from the node. */
+  bf_mc_lag_map_t add_lags;   /**< LAGs to add to the node. */
+  bf_mc_lag_map_t rem_lags;   /**< LAGs to remove from the node. */
+} bf_mc_node_delta_t;
+
 /* @} */
 
 /**
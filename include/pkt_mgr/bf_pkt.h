@@ -96,6 +96,25 @@ int bf_pkt_data_copy(bf_pkt *pkt, const uint8_t *pkt_buf, uint16_t size);
  */
 int bf_pkt_free(bf_dev_id_t id, bf_pkt *pkt);
 
+/**
+ * free a burst of packets
+ *
+ * Received packets are only returned to their rx ring by bf_pkt_free() or
+ * bf_pkt_free_burst(). While the application holds them the ring cannot
+ * be refilled, and once all its buffers are held, further packets are
+ * dropped by the hardware, in poll mode as well as in interrupt mode.
+ *
+ * @param id
+ *   chip id
+ * @param pkts
+ *   array of bf packets
+ * @param num_pkts
+ *   number of packets in the array
+ * @return
+ *   0 on success, -1 on failure
+ */
+int bf_pkt_free_burst(bf_dev_id_t id, bf_pkt **pkts, uint32_t num_pkts);
+
 /**
  * free all packets allocated for a device
  *
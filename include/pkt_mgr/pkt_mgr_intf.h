@@ -80,6 +80,28 @@ typedef bf_status_t (*bf_pkt_tx_done_notif_cb)(bf_dev_id_t dev_id,
                                                uint64_t tx_cookie,
                                                uint32_t status);
 
+/**
+ * Packet Transmit Done burst notification callback. Delivers the completions
+ * of num packets at once; tx_cookies and status are arrays of num entries
+ * owned by the packet manager and only valid for the duration of the
+ * callback
+ */
+typedef bf_status_t (*bf_pkt_tx_done_burst_notif_cb)(bf_dev_id_t dev_id,
+                                                     bf_pkt_tx_ring_t tx_ring,
+                                                     const uint64_t *tx_cookies,
+                                                     const uint32_t *status,
+                                                     uint32_t num);
+
+/**
+ * Structure for the configuration of a TX ring
+ */
+typedef struct bf_pkt_tx_ring_cfg_s {
+  bool lockless;           /** Submit through a lock-free multi producer
+                               queue instead of the ring lock */
+  uint32_t queue_depth;    /** Entries of the submission queue, power of 2 */
+  uint32_t doorbell_batch; /** Max descriptors posted per doorbell write */
+} bf_pkt_tx_ring_cfg_t;
+
 /**
  * Packet rx callback for processing
  */
@@ -88,6 +110,26 @@ typedef bf_status_t (*bf_pkt_rx_callback)(bf_dev_id_t dev_id,
                                           void *cookie,
                                           bf_pkt_rx_ring_t rx_ring);
 
+/**
+ * Maximum number of packets handed over by one burst rx callback or
+ * accepted by one burst tx call
+ */
+#define BF_PKT_BURST_MAX 256
+
+/**
+ * Packet burst rx callback for processing. The packets are not copied: their
+ * payload points straight into the buffers of the BF_DMA_CPU_PKT_RECEIVE_n
+ * pool of the ring. The ownership of every packet passes to the callback,
+ * which releases them with bf_pkt_free() or bf_pkt_free_burst() so that the
+ * buffers are returned to the ring. The pkts array itself belongs to the
+ * packet manager and is only valid for the duration of the callback.
+ */
+typedef bf_status_t (*bf_pkt_rx_burst_callback)(bf_dev_id_t dev_id,
+                                                bf_pkt **pkts,
+                                                uint32_t num_pkts,
+                                                void *cookie,
+                                                bf_pkt_rx_ring_t rx_ring);
+
 /**
  * @brief Check if the packet manager is initialized or not
  *
@@ -126,6 +168,50 @@ bf_status_t bf_pkt_rx_register(bf_dev_id_t dev_id,
  */
 bf_status_t bf_pkt_rx_deregister(bf_dev_id_t dev_id, bf_pkt_rx_ring_t rx_ring);
 
+/**
+ * @brief Register burst callback for RX packet processing. All the packets
+ * found on the ring by one servicing pass are handed over in bursts of up to
+ * max_burst packets. Only one of bf_pkt_rx_register() and
+ * bf_pkt_rx_burst_register() can be in effect on a ring.
+ * Deregistered with bf_pkt_rx_deregister().
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] cb Burst callback handler
+ * @param[in] rx_ring RX DR ring index
+ * @param[in] max_burst Maximum number of packets per callback, up to
+ * BF_PKT_BURST_MAX
+ * @param[in] rx_cookie Cookie to pass back to callback function
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_rx_burst_register(bf_dev_id_t dev_id,
+                                     bf_pkt_rx_burst_callback cb,
+                                     bf_pkt_rx_ring_t rx_ring,
+                                     uint32_t max_burst,
+                                     void *rx_cookie);
+
+/**
+ * @brief Receive a burst of packets from an RX ring without a callback. The
+ * packets are not copied and are owned by the caller, who releases them
+ * with bf_pkt_free() or bf_pkt_free_burst(). The ring must not have a
+ * callback registered.
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] rx_ring RX DR ring index
+ * @param[out] pkts Array of packets received. User needs to allocate memory
+ * @param[in] max_pkts Size of the pkts array
+ * @param[out] num_pkts Number of packets received, 0 if the ring is empty
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_rx_burst(bf_dev_id_t dev_id,
+                            bf_pkt_rx_ring_t rx_ring,
+                            bf_pkt **pkts,
+                            uint32_t max_pkts,
+                            uint32_t *num_pkts);
+
 /**
  * @brief Transmit a packet
  *
@@ -142,6 +228,30 @@ bf_status_t bf_pkt_tx(bf_dev_id_t dev_id,
                       bf_pkt_tx_ring_t tx_ring,
                       void *tx_cookie);
 
+/**
+ * @brief Transmit a burst of packets. The descriptors of all the packets
+ * are posted to the ring before the ring is notified once. Packets are
+ * posted in order and posting stops at the first packet which does not fit
+ * in the ring; the packets which were not posted stay owned by the caller.
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] pkts Array of packets to be transmitted
+ * @param[in] num_pkts Number of packets in the array, up to BF_PKT_BURST_MAX
+ * @param[in] tx_ring TX DR ring index
+ * @param[in] tx_cookies Array of cookies to pass back to TX done
+ * notification, one per packet
+ * @param[out] num_sent Number of packets posted to the ring
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_tx_burst(bf_dev_id_t dev_id,
+                            bf_pkt **pkts,
+                            uint32_t num_pkts,
+                            bf_pkt_tx_ring_t tx_ring,
+                            void *const *tx_cookies,
+                            uint32_t *num_sent);
+
 /**
  * @brief Register callback for TX done notification
  *
@@ -168,6 +278,60 @@ bf_status_t bf_pkt_tx_done_notif_register(bf_dev_id_t dev_id,
 bf_status_t bf_pkt_tx_done_notif_deregister(bf_dev_id_t dev_id,
                                             bf_pkt_tx_ring_t tx_ring);
 
+/**
+ * @brief Register burst callback for TX done notification. All the
+ * completions found on the ring by one servicing pass are delivered in one
+ * call. Only one of bf_pkt_tx_done_notif_register() and
+ * bf_pkt_tx_done_burst_notif_register() can be in effect on a ring.
+ * Deregistered with bf_pkt_tx_done_notif_deregister().
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] cb Burst callback handler
+ * @param[in] tx_ring TX DR ring index
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_tx_done_burst_notif_register(
+    bf_dev_id_t dev_id, bf_pkt_tx_done_burst_notif_cb cb,
+    bf_pkt_tx_ring_t tx_ring);
+
+/**
+ * @brief Configure a TX ring. In lockless mode, bf_pkt_tx() and
+ * bf_pkt_tx_burst() append the packets to a per ring multi producer single
+ * consumer queue with atomic operations only and never take the ring or the
+ * device lock. The queue is drained onto the ring by a single consumer,
+ * which posts up to doorbell_batch descriptors per doorbell write. The
+ * consumer is the poll thread owning the completions of the ring in poll
+ * mode, else whichever submitting thread finds the ring idle. A submission
+ * to a full queue fails with BF_NO_SYS_RESOURCES. Can only be changed while
+ * the ring has no packet in flight.
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] tx_ring TX DR ring index
+ * @param[in] cfg Ring configuration
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_tx_ring_cfg_set(bf_dev_id_t dev_id,
+                                   bf_pkt_tx_ring_t tx_ring,
+                                   const bf_pkt_tx_ring_cfg_t *cfg);
+
+/**
+ * @brief Get the configuration of a TX ring
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] tx_ring TX DR ring index
+ * @param[out] cfg Ring configuration
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_tx_ring_cfg_get(bf_dev_id_t dev_id,
+                                   bf_pkt_tx_ring_t tx_ring,
+                                   bf_pkt_tx_ring_cfg_t *cfg);
+
 /**
  * @brief Packet manager lock device message handler
  *
@@ -308,6 +472,106 @@ bf_status_t bf_dma_service_pkt(bf_dev_id_t chip);
  */
 bf_status_t pkt_mgr_dr_int_en(bf_dev_id_t chip, bool en);
 
+/**
+ * Maximum number of packet poll threads per device
+ */
+#define BF_PKT_POLL_THREADS_MAX 16
+
+/**
+ * Structure for the configuration of one packet poll thread
+ */
+typedef struct bf_pkt_poll_thread_cfg_s {
+  int cpu_core;          /** Core the thread is pinned to, -1 to not pin */
+  uint32_t rx_ring_mask; /** Bitmap of the bf_pkt_rx_ring_t it services */
+  uint32_t tx_ring_mask; /** Bitmap of the bf_pkt_tx_ring_t completions it
+                             services */
+} bf_pkt_poll_thread_cfg_t;
+
+/**
+ * Structure for the packet poll mode configuration
+ */
+typedef struct bf_pkt_poll_cfg_s {
+  uint32_t num_threads;    /** Number of poll threads */
+  uint32_t spin_count;     /** Empty polls before a thread starts backing
+                               off, 0 to spin without ever sleeping */
+  uint32_t backoff_min_us; /** First sleep once a thread backs off */
+  uint32_t backoff_max_us; /** Upper bound of the sleep, which doubles on
+                               every further empty poll */
+  bf_pkt_poll_thread_cfg_t thread[BF_PKT_POLL_THREADS_MAX];
+} bf_pkt_poll_cfg_t;
+
+/**
+ * Structure for the per rx ring counters of the poll mode
+ */
+typedef struct bf_pkt_poll_ring_stats_s {
+  uint64_t polls;           /** Number of times the ring was polled */
+  uint64_t empty_polls;     /** Number of polls which found no packet */
+  uint64_t pkts;            /** Number of packets received */
+  uint32_t occupancy;       /** Descriptors pending at the last poll */
+  uint32_t occupancy_max;   /** Highest occupancy seen by a poll */
+  uint64_t latency_ns_avg;  /** Average time from a packet being posted
+                                to the ring to its delivery */
+  uint64_t latency_ns_max;  /** Highest such time */
+} bf_pkt_poll_ring_stats_t;
+
+/**
+ * @brief Switch a device to packet poll mode. The packet tx and rx DR
+ * interrupts are disabled and the given threads are started; every thread
+ * busy polls the rings it owns and delivers packets to the callbacks
+ * registered with bf_pkt_rx_register() or bf_pkt_rx_burst_register(). A ring
+ * can be owned by one thread only. Rings not owned by any thread are not
+ * serviced and bf_dma_service_pkt() must not be called in poll mode.
+ * A poll thread refills a ring only with the buffers the application
+ * released with bf_pkt_free() or bf_pkt_free_burst(); packets held by the
+ * application are not returned to the ring, so holding too many of them
+ * stalls the refill and the hardware drops packets.
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] cfg Poll mode configuration
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_poll_mode_start(bf_dev_id_t dev_id,
+                                   const bf_pkt_poll_cfg_t *cfg);
+
+/**
+ * @brief Stop the poll threads of a device and switch it back to interrupt
+ * mode
+ *
+ * @param[in] dev_id Device identifier
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_poll_mode_stop(bf_dev_id_t dev_id);
+
+/**
+ * @brief Get the poll mode counters of an rx ring
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] rx_ring RX DR ring index
+ * @param[out] stats Ring counters
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_poll_ring_stats_get(bf_dev_id_t dev_id,
+                                       bf_pkt_rx_ring_t rx_ring,
+                                       bf_pkt_poll_ring_stats_t *stats);
+
+/**
+ * @brief Clear the poll mode counters of an rx ring
+ *
+ * @param[in] dev_id Device identifier
+ * @param[in] rx_ring RX DR ring index
+ *
+ * @return Status of the API call
+ *
+ */
+bf_status_t bf_pkt_poll_ring_stats_clear(bf_dev_id_t dev_id,
+                                         bf_pkt_rx_ring_t rx_ring);
+
 /**
  * @brief Initialize the driver. This should be called exactly once
  * before any other APIs are called.
@@ -176,6 +176,87 @@ typedef struct _p4_pd_tm_dev_cfg_t {
 
 } p4_pd_tm_dev_cfg_t;
 
+#define PD_TM_USAGE_POOL_COUNT (PD_EGRESS_POOL_3 + 1)
+
+typedef struct _p4_pd_tm_usage {
+  uint32_t count;  // cells in use
+  uint32_t wm;     // watermark in cells
+} p4_pd_tm_usage_t;
+
+typedef struct _p4_pd_tm_ppg_usage {
+  uint32_t gmin_count;    // cells in use from gmin pool
+  uint32_t shared_count;  // cells in use from shared pool
+  uint32_t skid_count;    // cells in use from skid pool
+  uint32_t wm;            // watermark in cells
+} p4_pd_tm_ppg_usage_t;
+
+typedef struct _p4_pd_tm_port_usage {
+  uint32_t ig_count;  // cells in use from Ingress TM perspective
+  uint32_t eg_count;  // cells in use from Egress TM perspective
+  uint32_t ig_wm;     // Ingress TM watermark in cells
+  uint32_t eg_wm;     // Egress TM watermark in cells
+} p4_pd_tm_port_usage_t;
+
+/*
+ * Caller provided buffers of p4_pd_tm_usage_snapshot_get(). Any of the
+ * arrays can be NULL to skip that kind of counter. With cfg from
+ * p4_pd_tm_dev_config_get(), the arrays are indexed as follows:
+ *   q:    physical pipe queue, pg * q_per_pg + queue within the port
+ *         group, up to pg_per_pipe * q_per_pg entries. Ports of a port
+ *         group do not all have the same number of queues, so use
+ *         p4_pd_tm_get_port_pipe_physical_queue() to find the entry of a
+ *         port queue and p4_pd_tm_get_pipe_queue_qid_list() to find the
+ *         port queues of an entry
+ *   ppg:  PPG number within the pipe, up to total_ppg_per_pipe entries
+ *   port: local_port, up to pg_per_pipe * ports_per_pg entries
+ *   pool: p4_pd_pool_id_t
+ */
+typedef struct _p4_pd_tm_usage_snapshot {
+  uint64_t timestamp_ns;        // CLOCK_MONOTONIC time of the read
+  p4_pd_tm_usage_t *q;          // queue usage
+  uint32_t q_cnt;               // entries in q
+  p4_pd_tm_ppg_usage_t *ppg;    // PPG usage
+  uint32_t ppg_cnt;             // entries in ppg
+  p4_pd_tm_port_usage_t *port;  // port usage
+  uint32_t port_cnt;            // entries in port
+  p4_pd_tm_usage_t pool[PD_TM_USAGE_POOL_COUNT];  // device wide pool usage
+} p4_pd_tm_usage_snapshot_t;
+
+#define PD_TM_SAMPLER_QUEUES_MAX 256
+
+typedef struct _p4_pd_tm_q_sample {
+  uint64_t timestamp_ns;  // CLOCK_MONOTONIC time of the sample
+  uint32_t count;         // cells in use
+  uint64_t drop_count;    // queue drop counter
+} p4_pd_tm_q_sample_t;
+
+typedef struct _p4_pd_tm_sampler_q {
+  p4_pd_tm_pipe_t pipe;
+  p4_pd_tm_port_t port;
+  p4_pd_tm_queue_t queue;
+  uint32_t threshold;  // cells, 0 disables threshold events for the queue
+} p4_pd_tm_sampler_q_t;
+
+typedef struct _p4_pd_tm_sampler_cfg {
+  uint32_t interval_us;  // sampling interval
+  uint32_t history;      // samples kept per queue, power of 2
+  int cpu_core;          // core the sampler thread is pinned to, -1 for none
+  uint32_t num_queues;   // entries used in queues
+  p4_pd_tm_sampler_q_t queues[PD_TM_SAMPLER_QUEUES_MAX];
+} p4_pd_tm_sampler_cfg_t;
+
+/*
+ * Called from the sampler thread when the usage of a queue goes above its
+ * threshold (above is true) or back to or below it (above is false).
+ * q_idx is the index of the queue in p4_pd_tm_sampler_cfg_t.queues.
+ */
+typedef void (*p4_pd_tm_sampler_threshold_cb)(
+    p4_pd_tm_dev_t dev,
+    uint32_t q_idx,
+    bool above,
+    const p4_pd_tm_q_sample_t *sample,
+    void *cookie);
+
 /**
  * @brief Allocate an unused PPG. The new PPG can be used to implement
  * part of QoS behaviour at ingress TM. If PPGs are exhausted, the API fails.
@@ -3436,6 +3517,38 @@ p4_pd_status_t p4_pd_tm_port_usage_get(p4_pd_tm_dev_t dev,
 p4_pd_status_t p4_pd_tm_port_watermark_clear(p4_pd_tm_dev_t dev,
                                              p4_pd_tm_port_t port);
 
+/**
+ * Get usage and watermark of all queues, PPGs and ports of a pipe, and of
+ * the pools, in one call. On Tofino 2 and Tofino 3 the counters are
+ * fetched with a single BF_DMA_TM_BLOCK_READ DMA instead of one register
+ * read per counter, so they are all read at about the same time. Tofino 1
+ * has no TM block read DMA; there the API falls back to one register read
+ * per counter, as the per counter get APIs do, and the counters are not
+ * read at the same time.
+ * If clear_wm is set, the watermarks are cleared with separate register
+ * writes issued after the read has completed. An increase of a watermark
+ * after it was read and before its clear is lost; that window lasts from
+ * the block read (or the register read of the watermark on Tofino 1) to
+ * the clear write, i.e. the DMA completion time plus the time taken to
+ * issue the clears of the pipe.
+ *
+ * Related APIs: p4_pd_tm_q_usage_get(), p4_pd_tm_ppg_usage_get(),
+ *               p4_pd_tm_port_usage_get(), p4_pd_tm_pool_usage_get()
+ *
+ * @param[in] dev           ASIC device identifier.
+ * @param[in] pipe          Pipe Identifier.
+ * @param[in] clear_wm      Clear the watermarks which are read.
+ * @param[in,out] snap      Arrays to fill, see p4_pd_tm_usage_snapshot_t.
+ * @return                  Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+
+p4_pd_status_t p4_pd_tm_usage_snapshot_get(p4_pd_tm_dev_t dev,
+                                           p4_pd_tm_pipe_t pipe,
+                                           bool clear_wm,
+                                           p4_pd_tm_usage_snapshot_t *snap);
+
 /**
  * Get blocklevel drop counters for TM.
  * Blocklevel Drops, Error, or Discard Counters
@@ -3488,6 +3601,72 @@ p4_pd_status_t p4_pd_tm_stop_cache_counters_timer(p4_pd_tm_dev_t dev);
 
 p4_pd_status_t p4_pd_tm_start_cache_counters_timer(p4_pd_tm_dev_t dev);
 
+/**
+ * Start the microburst sampler. A dedicated thread reads the usage and
+ * drop counter of the configured queues every interval_us and stores
+ * them with a timestamp in a per queue ring of the last history samples.
+ * The rings are written by the sampler thread only and can be read
+ * without blocking it. The sampler is independent of the counter cache
+ * timer.
+ *
+ * Related APIs: p4_pd_tm_sampler_stop(), p4_pd_tm_sampler_samples_get(),
+ *               p4_pd_tm_sampler_threshold_cb_register()
+ *
+ * @param[in] dev           ASIC device identifier.
+ * @param[in] cfg           Sampler configuration.
+ * @return                  Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+
+p4_pd_status_t p4_pd_tm_sampler_start(p4_pd_tm_dev_t dev,
+                                      const p4_pd_tm_sampler_cfg_t *cfg);
+
+/**
+ * Stop the microburst sampler and free its sample history.
+ *
+ * @param[in] dev           ASIC device identifier.
+ * @return                  Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+
+p4_pd_status_t p4_pd_tm_sampler_stop(p4_pd_tm_dev_t dev);
+
+/**
+ * Get the latest samples of a queue, oldest first.
+ *
+ * @param[in] dev           ASIC device identifier.
+ * @param[in] q_idx         Index of the queue in the sampler configuration.
+ * @param[in] max_samples   Max number of samples to return.
+ * @param[out] samples      Array of at least max_samples samples.
+ * @param[out] num_samples  Number of samples returned.
+ * @return                  Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+
+p4_pd_status_t p4_pd_tm_sampler_samples_get(p4_pd_tm_dev_t dev,
+                                            uint32_t q_idx,
+                                            uint32_t max_samples,
+                                            p4_pd_tm_q_sample_t *samples,
+                                            uint32_t *num_samples);
+
+/**
+ * Register a callback for threshold crossings of the sampled queues. Only
+ * one callback can be registered per device, NULL unregisters it.
+ *
+ * @param[in] dev           ASIC device identifier.
+ * @param[in] cb            Threshold crossing callback.
+ * @param[in] cookie        Passed to the callback.
+ * @return                  Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+
+p4_pd_status_t p4_pd_tm_sampler_threshold_cb_register(
+    p4_pd_tm_dev_t dev, p4_pd_tm_sampler_threshold_cb cb, void *cookie);
+
 // TM Queue Stats reporting (QSTAT) API
 
 /**
@@ -0,0 +1,91 @@
+/* 
+ * Copyright (c) Intel Corporation
+ * SPDX-License-Identifier: CC-BY-ND-4.0
+ */
+
+
+#ifndef __TRAFFIC_MGR_BATCH_INTF_H__
+#define __TRAFFIC_MGR_BATCH_INTF_H__
+
+/**
+ * @file traffic_mgr_batch_intf.h
+ *
+ * @brief This file contains APIs for Traffic Manager application to
+ *        group many queue, port, pool and scheduler configuration
+ *        changes into a single hardware update.
+ */
+
+#include <traffic_mgr/traffic_mgr_types.h>
+#include <bf_types/bf_types.h>
+
+/**
+ * @addtogroup tm-batch
+ * @{
+ */
+
+/**
+ * @brief Begin a TM batch on a device.
+ * Until the batch is ended, the TM set APIs of the device
+ * (bf_tm_q_*_set(), bf_tm_sched_*_set(), bf_tm_port_*_set(),
+ * bf_tm_pool_*_set(), ...) validate their arguments and update the TM
+ * software state as usual, but the register writes they cause are staged
+ * instead of being issued. A register written more than once in the batch
+ * is only written with its last value. The get APIs return the staged
+ * values. Only one batch can be in progress per device.
+ *
+ * Related APIs: bf_tm_batch_end(), bf_tm_batch_abort()
+ *
+ * @param[in] dev        ASIC device identifier.
+ * @return               Status of API call.
+ *  BF_SUCCESS on success
+ *  BF_IN_USE if a batch is already in progress on the device
+ */
+bf_status_t bf_tm_batch_begin(bf_dev_id_t dev);
+
+/**
+ * @brief End the TM batch of a device.
+ * All the staged register writes are pushed to the hardware as
+ * BF_DMA_TM_WRITE_LIST DMA in as few buffers as possible.
+ *
+ * Related APIs: bf_tm_batch_begin()
+ *
+ * @param[in] dev             ASIC device identifier.
+ * @param[in] hw_synchronous  Wait until the hardware has completed all the
+ *                            writes of the batch.
+ * @return                    Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+bf_status_t bf_tm_batch_end(bf_dev_id_t dev, bool hw_synchronous);
+
+/**
+ * @brief Abort the TM batch of a device.
+ * The staged register writes are dropped and the TM software state is
+ * restored to what it was when the batch began.
+ *
+ * Related APIs: bf_tm_batch_begin()
+ *
+ * @param[in] dev        ASIC device identifier.
+ * @return               Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+bf_status_t bf_tm_batch_abort(bf_dev_id_t dev);
+
+/**
+ * @brief Get whether a TM batch is in progress on a device.
+ *
+ * @param[in] dev          ASIC device identifier.
+ * @param[out] in_progress True if a batch is in progress.
+ * @param[out] num_writes  Number of register writes staged so far.
+ * @return                 Status of API call.
+ *  BF_SUCCESS on success
+ *  Non-Zero on error
+ */
+bf_status_t bf_tm_batch_status_get(bf_dev_id_t dev,
+                                   bool *in_progress,
+                                   uint32_t *num_writes);
+
+/* @} */
+
+#endif
@@ -0,0 +1,369 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) Intel Corporation
+# SPDX-License-Identifier: CC-BY-ND-4.0
+#
+
+"""Generate typed C++ table bindings from a bf-rt.json file.
+
+For every table which has a packed layout (see bf_rt/bf_rt_table_packed.hpp)
+a struct is emitted holding the table ID, the layout ID, a fixed size Key
+struct and one fixed size Data struct per action. Every field gets constexpr
+offset/size constants and inline setters/getters writing straight into the
+packed buffer, so programming an entry needs neither field ID lookups nor
+per-field virtual calls:
+
+    bf_rt_typed_gen.py bf-rt.json -n my_prog -o my_prog_bfrt.hpp
+
+    my_prog::pipe_SwitchIngress_fwd::Key key;
+    key.hdr_ipv4_dst_addr(0x0a000001, 32);
+    my_prog::pipe_SwitchIngress_fwd::ActionSetPort data;
+    data.port(5);
+    bfrt::packed::tableEntryAdd(*table, *session, dev_tgt, flags, key, data);
+
+Integer fields and bytes fields of up to 8 bytes are set and read as
+uint64_t, wider bytes fields through a pointer to their bytes in network
+order. Non-Exact key fields have one setter taking both values and a getter
+for each of them (e.g. addr() and addr_mask() for a Ternary field).
+bf_rt_typed_gen_example.json is a small P4 program covering every match
+type and action parameters of various widths.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+CPP_KEYWORDS = {
+    "alignas", "alignof", "and", "asm", "auto", "bool", "break", "case",
+    "catch", "char", "class", "const", "constexpr", "continue", "default",
+    "delete", "do", "double", "else", "enum", "explicit", "export", "extern",
+    "false", "float", "for", "friend", "goto", "if", "inline", "int", "long",
+    "mutable", "namespace", "new", "not", "operator", "or", "private",
+    "protected", "public", "register", "return", "short", "signed", "sizeof",
+    "static", "struct", "switch", "template", "this", "throw", "true", "try",
+    "typedef", "typename", "union", "unsigned", "using", "virtual", "void",
+    "volatile", "while", "xor", "bytes",
+}
+
+INT_WIDTHS = {"uint8": 8, "uint16": 16, "uint32": 32, "uint64": 64}
+
+
+class NotPackable(Exception):
+    pass
+
+
+def ident(name):
+    out = re.sub(r"[^0-9A-Za-z_]", "_", name).strip("_")
+    out = re.sub(r"_+", "_", out)
+    if not out or out[0].isdigit():
+        out = "f_" + out
+    if out in CPP_KEYWORDS:
+        out += "_"
+    return out
+
+
+def camel(name):
+    return "".join(p[:1].upper() + p[1:] for p in ident(name).split("_"))
+
+
+def fnv1a64(text):
+    h = 0xCBF29CE484222325
+    for b in text.encode():
+        h ^= b
+        h = (h * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def field_kind(field):
+    """Return (kind, size in bytes, choices) of a singleton field."""
+    if field.get("repeated", False):
+        raise NotPackable("repeated field %s" % field["name"])
+    t = field["type"]
+    tname = t["type"]
+    if tname in INT_WIDTHS:
+        return "int", INT_WIDTHS[tname] // 8, None
+    if tname == "bytes":
+        return "bytes", (t["width"] + 7) // 8, None
+    if tname == "bool":
+        return "bool", 1, None
+    if tname == "float":
+        return "float", 4, None
+    if tname == "string" and t.get("choices"):
+        return "choice", 4, t["choices"]
+    raise NotPackable("field %s of type %s" % (field["name"], tname))
+
+
+# Key match types and the value following the key value in the packed key:
+# (name of the accessor argument, size in bytes or None for the key size)
+KEY_SECOND = {
+    "Exact": None,
+    "Ternary": ("mask", None),
+    "Range": ("end", None),
+    "LPM": ("p_length", 2),
+    "Optional": ("is_valid", 1),
+}
+
+
+def data_fields(entries):
+    """Return the field objects of a data list. Table data fields are
+    wrapped in "singleton" (or "oneof"), action fields are not."""
+    out = []
+    for entry in entries:
+        if "oneof" in entry:
+            raise NotPackable("oneof data field")
+        out.append(entry.get("singleton", entry))
+    return out
+
+
+class Table(object):
+    def __init__(self, tbl):
+        self.tbl = tbl
+        self.name = tbl["name"]
+        self.id = tbl["id"]
+        self.key = []
+        for k in tbl.get("key", []):
+            kind, size, _ = field_kind(k)
+            if kind not in ("int", "bytes", "bool"):
+                raise NotPackable("key field %s" % k["name"])
+            if k["match_type"] not in KEY_SECOND:
+                raise NotPackable("key field %s with match type %s" %
+                                  (k["name"], k["match_type"]))
+            self.key.append((k, k["match_type"], size))
+        self.common = [(f, field_kind(f)) for f in data_fields(tbl.get("data", []))]
+        self.actions = []
+        for a in tbl.get("action_specs", []):
+            fields = [(f, field_kind(f)) for f in data_fields(a.get("data", []))]
+            self.actions.append((a, fields))
+
+    def layout_text(self):
+        text = "T%d;" % self.id
+        for k, match, size in self.key:
+            text += "K%d:%s:%d;" % (k["id"], match, size)
+        for a, fields in self.actions:
+            text += "A%d;" % a["id"]
+            for f, (_, size, _) in fields:
+                text += "D%d:%d;" % (f["id"], size)
+        for f, (_, size, _) in self.common:
+            text += "D%d:%d;" % (f["id"], size)
+        return text
+
+    def layout_id(self):
+        return fnv1a64(self.layout_text())
+
+
+def emit_value_accessors(out, name, offset, size, kind, choices, indent):
+    p = " " * indent
+    if kind == "bytes" and size <= 8:
+        kind = "int"
+    if kind == "int" or kind == "bool":
+        ctype = "bool" if kind == "bool" else "uint64_t"
+        out.append("%svoid %s(const %s &value) {" % (p, name, ctype))
+        out.append("%s  bfrt::packed::fieldSet(bytes + %d, %d, value);" % (p, offset, size))
+        out.append("%s}" % p)
+        out.append("%s%s %s() const {" % (p, ctype, name))
+        cast = "0 != " if kind == "bool" else ""
+        out.append("%s  return %sbfrt::packed::fieldGet(bytes + %d, %d);" % (p, cast, offset, size))
+        out.append("%s}" % p)
+    elif kind == "bytes":
+        out.append("%svoid %s(const uint8_t *value) {" % (p, name))
+        out.append("%s  bfrt::packed::fieldSet(bytes + %d, %d, value);" % (p, offset, size))
+        out.append("%s}" % p)
+        out.append("%sconst uint8_t *%s() const { return bytes + %d; }" % (p, name, offset))
+    elif kind == "float":
+        out.append("%svoid %s(const float &value) {" % (p, name))
+        out.append("%s  bfrt::packed::fieldSetFloat(bytes + %d, value);" % (p, offset))
+        out.append("%s}" % p)
+        out.append("%sfloat %s() const {" % (p, name))
+        out.append("%s  return bfrt::packed::fieldGetFloat(bytes + %d);" % (p, offset))
+        out.append("%s}" % p)
+    elif kind == "choice":
+        enum = camel(name) + "Choice"
+        out.append("%senum class %s : uint32_t {" % (p, enum))
+        for i, c in enumerate(choices):
+            out.append("%s  %s = %d," % (p, ident(c), i))
+        out.append("%s};" % p)
+        out.append("%svoid %s(const %s &value) {" % (p, name, enum))
+        out.append("%s  bfrt::packed::fieldSet(" % p)
+        out.append("%s      bytes + %d, %d, static_cast<uint64_t>(value));" % (p, offset, size))
+        out.append("%s}" % p)
+        out.append("%s%s %s() const {" % (p, enum, name))
+        out.append("%s  return static_cast<%s>(bfrt::packed::fieldGet(bytes + %d, %d));" % (p, enum, offset, size))
+        out.append("%s}" % p)
+
+
+def unique_names(fields):
+    seen = {}
+    names = []
+    for f in fields:
+        n = ident(f["name"])
+        if n in seen or n == "bytes":
+            n = "%s_%d" % (n, f["id"])
+        seen[n] = True
+        names.append(n)
+    return names
+
+
+def emit_data_struct(out, struct, table, action, fields):
+    all_fields = fields + table.common
+    names = unique_names([f for f, _ in all_fields])
+    size = sum(k[1] for _, k in all_fields)
+    out.append("  struct %s {" % struct)
+    out.append("    static constexpr uint64_t kLayoutId = kTableLayoutId;")
+    out.append("    static constexpr bf_rt_id_t kActionId = %du;" % (action["id"] if action else 0))
+    out.append("    static constexpr size_t kSize = %d;" % size)
+    offset = 0
+    for (f, (kind, fsize, choices)), n in zip(all_fields, names):
+        out.append("")
+        out.append("    /** %s */" % f["name"])
+        out.append("    static constexpr bf_rt_id_t k_%s_id = %du;" % (n, f["id"]))
+        out.append("    static constexpr size_t k_%s_offset = %d;" % (n, offset))
+        out.append("    static constexpr size_t k_%s_size = %d;" % (n, fsize))
+        emit_value_accessors(out, n, offset, fsize, kind, choices, 4)
+        offset += fsize
+    out.append("")
+    out.append("    uint8_t bytes[kSize > 0 ? kSize : 1] = {};")
+    out.append("  };")
+    out.append("")
+
+
+def emit_key_struct(out, table):
+    names = unique_names([k for k, _, _ in table.key])
+    size = 0
+    for _, match, fsize in table.key:
+        second = KEY_SECOND.get(match)
+        size += fsize
+        if second:
+            size += second[1] or fsize
+    out.append("  struct Key {")
+    out.append("    static constexpr uint64_t kLayoutId = kTableLayoutId;")
+    out.append("    static constexpr size_t kSize = %d;" % size)
+    offset = 0
+    for (k, match, fsize), n in zip(table.key, names):
+        kind, _, _ = field_kind(k)
+        if kind == "bool":
+            kind = "int"
+        out.append("")
+        out.append("    /** %s (%s) */" % (k["name"], match))
+        out.append("    static constexpr bf_rt_id_t k_%s_id = %du;" % (n, k["id"]))
+        out.append("    static constexpr size_t k_%s_offset = %d;" % (n, offset))
+        out.append("    static constexpr size_t k_%s_size = %d;" % (n, fsize))
+        if match not in KEY_SECOND:
+            raise NotPackable("key field %s with match type %s" % (k["name"], match))
+        second = KEY_SECOND[match]
+        if second is None:
+            emit_value_accessors(out, n, offset, fsize, kind, None, 4)
+            offset += fsize
+            continue
+        arg, ssize = second[0], second[1] or fsize
+        wide = kind == "bytes" and fsize > 8
+        vtype = "const uint8_t *" if wide else "const uint64_t &"
+        if arg in ("mask", "end"):
+            stype = vtype
+        elif arg == "p_length":
+            stype = "const uint16_t &"
+        else:
+            stype = "const bool &"
+        out.append("    void %s(%svalue, %s%s) {" % (n, vtype, stype, arg))
+        out.append("      bfrt::packed::fieldSet(bytes + %d, %d, value);" % (offset, fsize))
+        out.append("      bfrt::packed::fieldSet(bytes + %d, %d, %s);" % (offset + fsize, ssize, arg))
+        out.append("    }")
+        if wide:
+            out.append("    const uint8_t *%s() const { return bytes + %d; }" % (n, offset))
+        else:
+            out.append("    uint64_t %s() const {" % n)
+            out.append("      return bfrt::packed::fieldGet(bytes + %d, %d);" % (offset, fsize))
+            out.append("    }")
+        if wide and arg in ("mask", "end"):
+            out.append("    const uint8_t *%s_%s() const { return bytes + %d; }" % (n, arg, offset + fsize))
+        else:
+            rtype = {"p_length": "uint16_t", "is_valid": "bool"}.get(arg, "uint64_t")
+            cast = "0 != " if arg == "is_valid" else ""
+            if arg == "p_length":
+                cast = "static_cast<uint16_t>("
+            out.append("    %s %s_%s() const {" % (rtype, n, arg))
+            out.append("      return %sbfrt::packed::fieldGet(bytes + %d, %d)%s;" % (
+                cast, offset + fsize, ssize, ")" if arg == "p_length" else ""))
+            out.append("    }")
+        offset += fsize + ssize
+    out.append("")
+    out.append("    uint8_t bytes[kSize > 0 ? kSize : 1] = {};")
+    out.append("  };")
+    out.append("")
+
+
+def emit_table(out, table):
+    struct = ident(table.name)
+    out.append("/** %s */" % table.name)
+    out.append("struct %s {" % struct)
+    out.append("  static constexpr bf_rt_id_t kTableId = %du;" % table.id)
+    out.append("  static constexpr uint64_t kTableLayoutId = 0x%016xull;" % table.layout_id())
+    out.append("")
+    emit_key_struct(out, table)
+    if table.actions:
+        seen = {}
+        for a, fields in table.actions:
+            name = "Action" + camel(a["name"].split(".")[-1])
+            if name in seen:
+                name += str(a["id"])
+            seen[name] = True
+            emit_data_struct(out, name, table, a, fields)
+    else:
+        emit_data_struct(out, "Data", table, None, [])
+    out.pop()
+    out.append("};")
+    out.append("")
+
+
+def generate(bfrt, namespace, guard):
+    out = []
+    out.append("/* Generated by bf_rt_typed_gen.py. Do not edit. */")
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("#include <bf_rt/bf_rt_table_packed.hpp>")
+    out.append("")
+    out.append("namespace %s {" % namespace)
+    out.append("")
+    skipped = []
+    for tbl in bfrt["tables"]:
+        try:
+            table = Table(tbl)
+        except NotPackable as e:
+            skipped.append((tbl["name"], str(e)))
+            continue
+        emit_table(out, table)
+    for name, why in skipped:
+        out.append("// %s: no packed layout (%s)" % (name, why))
+    out.append("")
+    out.append("}  // namespace %s" % namespace)
+    out.append("")
+    out.append("#endif  // %s" % guard)
+    return "\n".join(out) + "\n", skipped
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("bfrt_json", help="bf-rt.json of the program")
+    parser.add_argument("-n", "--namespace", required=True,
+                        help="C++ namespace of the generated structs")
+    parser.add_argument("-o", "--output", default="-",
+                        help="Output header, stdout by default")
+    args = parser.parse_args()
+
+    with open(args.bfrt_json) as f:
+        bfrt = json.load(f)
+    guard = "_%s_BFRT_TYPED_HPP" % ident(args.namespace).upper()
+    text, skipped = generate(bfrt, ident(args.namespace), guard)
+    if args.output == "-":
+        sys.stdout.write(text)
+    else:
+        with open(args.output, "w") as f:
+            f.write(text)
+    for name, why in skipped:
+        sys.stderr.write("Skipping %s: %s\n" % (name, why))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())